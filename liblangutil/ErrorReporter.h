@@ -48,6 +48,11 @@ public:
 	void append(ErrorList const& _errorList)
 	{
 		m_errorList += _errorList;
+		for (auto const& error: _errorList)
+			if (error->type() == Error::Type::Warning)
+				m_warningCount++;
+			else
+				m_errorCount++;
 	}
 
 	void warning(std::string const& _description);
@@ -2099,7 +2099,7 @@ bool TypeChecker::visit(FunctionCall const& _functionCall)
 		for (ASTPointer<Expression const> const& argument: arguments)
 			funcCallArgs.types.push_back(type(*argument));
 
-		_functionCall.expression().annotation().arguments = std::move(funcCallArgs);
+		_functionCall.expression().annotation().arguments = make_unique<FuncCallArguments const>(std::move(funcCallArgs));
 	}
 
 	_functionCall.expression().accept(*this);
@@ -142,7 +142,7 @@ struct VariableDeclarationAnnotation: DeclarationAnnotation
 	std::set<CallableDeclaration const*> baseFunctions;
 };
 
-struct StatementAnnotation: ASTAnnotation, DocumentedAnnotation
+struct StatementAnnotation: ASTAnnotation
 {
 };
 
@@ -210,8 +210,10 @@ struct ExpressionAnnotation: ASTAnnotation
 	bool lValueRequested = false;
 
 	/// Types and - if given - names of arguments if the expr. is a function
-	/// that is called, used for overload resoultion
-	std::optional<FuncCallArguments> arguments;
+	/// that is called, used for overload resoultion.
+	/// Only set for the few expressions that are called, so it is allocated separately
+	/// to keep the annotation of all other expressions small.
+	std::unique_ptr<FuncCallArguments const> arguments;
 };
 
 struct IdentifierAnnotation: ExpressionAnnotation
@@ -34,20 +34,23 @@ namespace solidity::frontend
  * This is the Solidity Compiler's type provider. Use it to request for types. The caller does
  * <b>not</b> own the types.
  *
+ * The type universe is owned by a thread-local instance, so that independent compilations
+ * can run concurrently as long as each of them stays on its own thread.
+ *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
  */
 class TypeProvider
 {
 public:
-	TypeProvider() = default;
-	TypeProvider(TypeProvider&&) = default;
+	TypeProvider();
+	TypeProvider(TypeProvider&&) = delete;
 	TypeProvider(TypeProvider const&) = delete;
-	TypeProvider& operator=(TypeProvider&&) = default;
+	TypeProvider& operator=(TypeProvider&&) = delete;
 	TypeProvider& operator=(TypeProvider const&) = delete;
 	~TypeProvider() = default;
 
-	/// Resets state of this TypeProvider to initial state, wiping all mutable types.
+	/// Resets state of the calling thread's TypeProvider to initial state, wiping all mutable types.
 	/// This invalidates all dangling pointers to types provided by this TypeProvider.
 	static void reset();
 
@@ -60,10 +63,10 @@ public:
 	static TypePointer fromElementaryTypeName(std::string const& _name);
 
 	/// @returns boolean type.
-	static BoolType const* boolean() noexcept { return &m_boolean; }
+	static BoolType const* boolean() noexcept { return &instance().m_boolean; }
 
 	static FixedBytesType const* byte() { return fixedBytes(1); }
-	static FixedBytesType const* fixedBytes(unsigned m) { return m_bytesM.at(m - 1).get(); }
+	static FixedBytesType const* fixedBytes(unsigned m) { return instance().m_bytesM.at(m - 1).get(); }
 
 	static ArrayType const* bytesStorage();
 	static ArrayType const* bytesMemory();
@@ -82,16 +85,16 @@ public:
 
 	static ArraySliceType const* arraySlice(ArrayType const& _arrayType);
 
-	static AddressType const* payableAddress() noexcept { return &m_payableAddress; }
-	static AddressType const* address() noexcept { return &m_address; }
+	static AddressType const* payableAddress() noexcept { return &instance().m_payableAddress; }
+	static AddressType const* address() noexcept { return &instance().m_address; }
 
 	static IntegerType const* integer(unsigned _bits, IntegerType::Modifier _modifier)
 	{
 		solAssert((_bits % 8) == 0, "");
 		if (_modifier == IntegerType::Modifier::Unsigned)
-			return m_uintM.at(_bits / 8 - 1).get();
+			return instance().m_uintM.at(_bits / 8 - 1).get();
 		else
-			return m_intM.at(_bits / 8 - 1).get();
+			return instance().m_intM.at(_bits / 8 - 1).get();
 	}
 	static IntegerType const* uint(unsigned _bits) { return integer(_bits, IntegerType::Modifier::Unsigned); }
 
@@ -105,7 +108,7 @@ public:
 	/// @returns a tuple type with the given members.
 	static TupleType const* tuple(std::vector<Type const*> members);
 
-	static TupleType const* emptyTuple() noexcept { return &m_emptyTuple; }
+	static TupleType const* emptyTuple() noexcept { return &instance().m_emptyTuple; }
 
 	static ReferenceType const* withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer);
 
@@ -168,7 +171,7 @@ public:
 
 	static ContractType const* contract(ContractDefinition const& _contract, bool _isSuper = false);
 
-	static InaccessibleDynamicType const* inaccessibleDynamic() noexcept { return &m_inaccessibleDynamic; }
+	static InaccessibleDynamicType const* inaccessibleDynamic() noexcept { return &instance().m_inaccessibleDynamic; }
 
 	/// @returns the type of an enum instance for given definition, there is one distinct type per enum definition.
 	static EnumType const* enumType(EnumDefinition const& _enum);
@@ -189,33 +192,34 @@ public:
 	static MappingType const* mapping(Type const* _keyType, Type const* _valueType);
 
 private:
-	/// Global TypeProvider instance.
+	/// TypeProvider instance of the calling thread.
 	static TypeProvider& instance()
 	{
-		static TypeProvider _provider;
+		static thread_local TypeProvider _provider;
 		return _provider;
 	}
 
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
-	static BoolType const m_boolean;
-	static InaccessibleDynamicType const m_inaccessibleDynamic;
-
-	/// These are lazy-initialized because they depend on `byte` being available.
-	static std::unique_ptr<ArrayType> m_bytesStorage;
-	static std::unique_ptr<ArrayType> m_bytesMemory;
-	static std::unique_ptr<ArrayType> m_bytesCalldata;
-	static std::unique_ptr<ArrayType> m_stringStorage;
-	static std::unique_ptr<ArrayType> m_stringMemory;
-
-	static TupleType const m_emptyTuple;
-	static AddressType const m_payableAddress;
-	static AddressType const m_address;
-	static std::array<std::unique_ptr<IntegerType>, 32> const m_intM;
-	static std::array<std::unique_ptr<IntegerType>, 32> const m_uintM;
-	static std::array<std::unique_ptr<FixedBytesType>, 32> const m_bytesM;
-	static std::array<std::unique_ptr<MagicType>, 4> const m_magics;        ///< MagicType's except MetaType
+	BoolType const m_boolean{};
+	InaccessibleDynamicType const m_inaccessibleDynamic{};
+
+	/// These are lazy-initialized because they depend on `byte` being available,
+	/// i.e. on the instance being fully constructed.
+	std::unique_ptr<ArrayType> m_bytesStorage;
+	std::unique_ptr<ArrayType> m_bytesMemory;
+	std::unique_ptr<ArrayType> m_bytesCalldata;
+	std::unique_ptr<ArrayType> m_stringStorage;
+	std::unique_ptr<ArrayType> m_stringMemory;
+
+	TupleType const m_emptyTuple{};
+	AddressType const m_payableAddress{StateMutability::Payable};
+	AddressType const m_address{StateMutability::NonPayable};
+	std::array<std::unique_ptr<IntegerType>, 32> const m_intM;
+	std::array<std::unique_ptr<IntegerType>, 32> const m_uintM;
+	std::array<std::unique_ptr<FixedBytesType>, 32> const m_bytesM;
+	std::array<std::unique_ptr<MagicType>, 4> const m_magics;        ///< MagicType's except MetaType
 
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_ufixedMxN{};
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
@@ -290,6 +290,11 @@ string ABIFunctions::abiEncodingFunction(
 			case DataLocation::Memory:
 				if (fromArray.isByteArray())
 					return abiEncodingFunctionMemoryByteArray(fromArray, *toArray, _options);
+				else if (
+					*fromArray.baseType() == *TypeProvider::uint256() ||
+					*fromArray.baseType() == FixedBytesType(32)
+				)
+					return abiEncodingFunctionMemoryArrayWithoutCleanup(fromArray, *toArray, _options);
 				else
 					return abiEncodingFunctionSimpleArray(fromArray, *toArray, _options);
 			case DataLocation::Storage:
@@ -632,6 +637,69 @@ string ABIFunctions::abiEncodingFunctionMemoryByteArray(
 	});
 }
 
+string ABIFunctions::abiEncodingFunctionMemoryArrayWithoutCleanup(
+	ArrayType const& _from,
+	ArrayType const& _to,
+	EncodingOptions const& _options
+)
+{
+	string functionName =
+		"abi_encode_" +
+		_from.identifier() +
+		"_to_" +
+		_to.identifier() +
+		_options.toFunctionNameSuffix();
+
+	solAssert(_from.isDynamicallySized() == _to.isDynamicallySized(), "");
+	solAssert(_from.length() == _to.length(), "");
+	solAssert(_from.dataStoredIn(DataLocation::Memory), "");
+	solAssert(
+		*_from.baseType() == *TypeProvider::uint256() ||
+		*_from.baseType() == FixedBytesType(32),
+		""
+	);
+	solAssert(_from.memoryStride() == 32 && _to.memoryStride() == 32, "");
+	solAssert(*_from.baseType() == *_to.baseType(), "");
+
+	return createFunction(functionName, [&]() {
+		if (_from.isDynamicallySized())
+		{
+			Whiskers templ(R"(
+				// <readableTypeNameFrom> -> <readableTypeNameTo>
+				function <functionName>(value, pos) -> end {
+					let length := <lengthFun>(value)
+					pos := <storeLength>(pos, length)
+					length := mul(length, 0x20)
+					<copyFun>(add(value, 0x20), pos, length)
+					end := add(pos, length)
+				}
+			)");
+			templ("functionName", functionName);
+			templ("readableTypeNameFrom", _from.toString(true));
+			templ("readableTypeNameTo", _to.toString(true));
+			templ("lengthFun", m_utils.arrayLengthFunction(_from));
+			templ("storeLength", arrayStoreLengthForEncodingFunction(_to, _options));
+			templ("copyFun", m_utils.copyToMemoryFunction(false));
+			return templ.render();
+		}
+		else
+		{
+			Whiskers templ(R"(
+				// <readableTypeNameFrom> -> <readableTypeNameTo>
+				function <functionName>(value, pos) {
+					<copyFun>(value, pos, <byteLength>)
+				}
+			)");
+			templ("functionName", functionName);
+			templ("readableTypeNameFrom", _from.toString(true));
+			templ("readableTypeNameTo", _to.toString(true));
+			templ("copyFun", m_utils.copyToMemoryFunction(false));
+			templ("byteLength", toCompactHexWithPrefix(_from.length() * 32));
+			return templ.render();
+		}
+	});
+}
+
 string ABIFunctions::abiEncodingFunctionCompactStorageArray(
 	ArrayType const& _from,
 	ArrayType const& _to,
@@ -163,6 +163,14 @@ private:
 		ArrayType const& _targetType,
 		EncodingOptions const& _options
 	);
+	/// Part of @a abiEncodingFunction for array target type and given memory array.
+	/// Copies the whole data area word by word and does not perform cleanup and can therefore
+	/// only be used for arrays with the base type uint256 or bytes32.
+	std::string abiEncodingFunctionMemoryArrayWithoutCleanup(
+		ArrayType const& _givenType,
+		ArrayType const& _targetType,
+		EncodingOptions const& _options
+	);
 	/// Part of @a abiEncodingFunction for array target type and given storage array
 	/// where multiple items are packed into the same storage slot.
 	std::string abiEncodingFunctionCompactStorageArray(
@@ -35,11 +35,16 @@ namespace solidity::frontend {
 class Compiler
 {
 public:
-	Compiler(langutil::EVMVersion _evmVersion, RevertStrings _revertStrings, OptimiserSettings _optimiserSettings):
+	Compiler(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<YulFunctionCache> _functionCache = nullptr
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_revertStrings(_revertStrings),
-		m_runtimeContext(_evmVersion),
-		m_context(_evmVersion, &m_runtimeContext)
+		m_runtimeContext(_evmVersion, nullptr, _functionCache),
+		m_context(_evmVersion, &m_runtimeContext, _functionCache)
 	{ }
 
 	/// Compiles a contract.
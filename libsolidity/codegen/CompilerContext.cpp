@@ -41,6 +41,8 @@
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 
+#include <libsolutil/StringUtils.h>
+
 #include <boost/algorithm/string/replace.hpp>
 
 #include <utility>
@@ -381,6 +383,35 @@ void CompilerContext::appendInlineAssembly(
 		}
 	};
 
+	bool const isCreation = m_runtimeContext != nullptr;
+	// Several optimizer steps cannot handle externally supplied stack variables,
+	// so we essentially only optimize the ABI functions.
+	bool const optimize = _optimiserSettings.runYulOptimiser && _localVariables.empty();
+	// The analysis only depends on the names of the local variables and the optimised
+	// code also on the externally used functions and on the gas meter.
+	string cacheKey;
+	if (m_functionCache)
+	{
+		cacheKey = util::joinHumanReadable(_localVariables) + "\n";
+		if (optimize)
+			cacheKey += (isCreation ? "creation " : "runtime ") + util::joinHumanReadable(_externallyUsedFunctions);
+		cacheKey += "\n" + _assembly;
+		if (YulFunctionCache::ParsedBlock const* cached = m_functionCache->parsedBlock(cacheKey))
+		{
+			yul::CodeGenerator::assemble(
+				*cached->code,
+				*cached->analysisInfo,
+				*m_asm,
+				m_evmVersion,
+				identifierAccess,
+				_system,
+				_optimiserSettings.optimizeStackAllocation
+			);
+			updateSourceLocation();
+			return;
+		}
+	}
+
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
 	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, "--CODEGEN--"));
@@ -405,11 +436,11 @@ void CompilerContext::appendInlineAssembly(
 		solAssert(false, message);
 	};
 
-	yul::AsmAnalysisInfo analysisInfo;
+	auto analysisInfo = make_shared<yul::AsmAnalysisInfo>();
 	bool analyzerResult = false;
 	if (parserResult)
 		analyzerResult = yul::AsmAnalyzer(
-			analysisInfo,
+			*analysisInfo,
 			errorReporter,
 			dialect,
 			identifierAccess.resolve
@@ -417,23 +448,25 @@ void CompilerContext::appendInlineAssembly(
 	if (!parserResult || !errorReporter.errors().empty() || !analyzerResult)
 		reportError("Invalid assembly generated by code generator.");
 
-	// Several optimizer steps cannot handle externally supplied stack variables,
-	// so we essentially only optimize the ABI functions.
-	if (_optimiserSettings.runYulOptimiser && _localVariables.empty())
+	if (optimize)
 	{
-		bool const isCreation = m_runtimeContext != nullptr;
 		yul::GasMeter meter(dialect, isCreation, _optimiserSettings.expectedExecutionsPerDeployment);
 		yul::Object obj;
 		obj.code = parserResult;
-		obj.analysisInfo = make_shared<yul::AsmAnalysisInfo>(analysisInfo);
+		obj.analysisInfo = analysisInfo;
 		yul::OptimiserSuite::run(
 			dialect,
 			&meter,
 			obj,
 			_optimiserSettings.optimizeStackAllocation,
+			_optimiserSettings.yulOptimiserSteps,
+			{
+				_optimiserSettings.yulOptimiserStepBudget,
+				chrono::milliseconds(_optimiserSettings.yulOptimiserTimeBudget)
+			},
 			externallyUsedIdentifiers
 		);
-		analysisInfo = std::move(*obj.analysisInfo);
+		analysisInfo = std::move(obj.analysisInfo);
 		parserResult = std::move(obj.code);
 
 #ifdef SOL_OUTPUT_ASM
@@ -446,9 +479,11 @@ void CompilerContext::appendInlineAssembly(
 		reportError("Failed to analyze inline assembly block.");
 
 	solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
+	if (m_functionCache)
+		m_functionCache->storeParsedBlock(move(cacheKey), {parserResult, analysisInfo});
 	yul::CodeGenerator::assemble(
 		*parserResult,
-		analysisInfo,
+		*analysisInfo,
 		*m_asm,
 		m_evmVersion,
 		identifierAccess,
@@ -26,6 +26,7 @@
 #include <libsolidity/ast/ASTForward.h>
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/codegen/ABIFunctions.h>
+#include <libsolidity/codegen/YulFunctionCache.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
@@ -51,11 +52,16 @@ class Compiler;
 class CompilerContext
 {
 public:
-	explicit CompilerContext(langutil::EVMVersion _evmVersion, CompilerContext* _runtimeContext = nullptr):
+	explicit CompilerContext(
+		langutil::EVMVersion _evmVersion,
+		CompilerContext* _runtimeContext = nullptr,
+		std::shared_ptr<YulFunctionCache> _functionCache = nullptr
+	):
 		m_asm(std::make_shared<evmasm::Assembly>()),
 		m_evmVersion(_evmVersion),
 		m_runtimeContext(_runtimeContext),
-		m_abiFunctions(m_evmVersion)
+		m_functionCache(_functionCache),
+		m_abiFunctions(m_evmVersion, std::make_shared<MultiUseYulFunctionCollector>(std::move(_functionCache)))
 	{
 		if (m_runtimeContext)
 			m_runtimeSub = size_t(m_asm->newSub(m_runtimeContext->m_asm).data());
@@ -211,6 +217,7 @@ public:
 	/// @param _localVariables assigns stack positions to variables with the last one being the stack top
 	/// @param _externallyUsedFunctions a set of function names that are not to be renamed or removed.
 	/// @param _system if true, this is a "system-level" assembly where all functions use named labels.
+	/// If there is a function cache, every distinct block is only parsed, analysed and optimised once.
 	void appendInlineAssembly(
 		std::string const& _assembly,
 		std::vector<std::string> const& _localVariables = std::vector<std::string>(),
@@ -333,6 +340,8 @@ private:
 	size_t m_runtimeSub = -1;
 	/// An index of low-level function labels by name.
 	std::map<std::string, evmasm::AssemblyItem> m_lowLevelFunctions;
+	/// Cache of generated and parsed Yul code shared between the contracts of a compilation, can be null.
+	std::shared_ptr<YulFunctionCache> m_functionCache;
 	/// Container for ABI functions to be generated.
 	ABIFunctions m_abiFunctions;
 	/// The queue of low-level functions to generate.
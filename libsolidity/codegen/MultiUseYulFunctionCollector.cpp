@@ -23,6 +23,8 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Common.h>
+
 #include <boost/algorithm/string/join.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 
@@ -41,12 +43,49 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 
 string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
 {
-	if (!m_requestedFunctions.count(_name))
+	return createFunction(_name, _creator, true);
+}
+
+string MultiUseYulFunctionCollector::createUncachedFunction(string const& _name, function<string ()> const& _creator)
+{
+	return createFunction(_name, _creator, false);
+}
+
+string MultiUseYulFunctionCollector::createFunction(
+	string const& _name,
+	function<string ()> const& _creator,
+	bool _useCache
+)
+{
+	if (!m_dependencies.empty())
+		m_dependencies.back().emplace_back(_name);
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	_useCache = _useCache && m_cache;
+	if (_useCache && m_cache->function(_name))
 	{
-		string fun = _creator();
-		solAssert(!fun.empty(), "");
-		solAssert(fun.find("function " + _name) != string::npos, "Function not properly named.");
-		m_requestedFunctions[_name] = std::move(fun);
+		addFromCache(_name);
+		return _name;
 	}
+
+	m_dependencies.emplace_back();
+	ScopeGuard popDependencies([&]() { m_dependencies.pop_back(); });
+	string fun = _creator();
+	solAssert(!fun.empty(), "");
+	solAssert(fun.find("function " + _name) != string::npos, "Function not properly named.");
+	if (_useCache)
+		m_cache->storeFunction(_name, {fun, m_dependencies.back()});
+	m_requestedFunctions[_name] = std::move(fun);
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::addFromCache(string const& _name)
+{
+	YulFunctionCache::Function const* cached = m_cache->function(_name);
+	solAssert(cached, "Function " + _name + " not cached.");
+	m_requestedFunctions[_name] = cached->code;
+	for (string const& dependency: cached->dependencies)
+		if (!m_requestedFunctions.count(dependency))
+			addFromCache(dependency);
+}
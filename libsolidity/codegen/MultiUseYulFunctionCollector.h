@@ -21,9 +21,13 @@
 
 #pragma once
 
+#include <libsolidity/codegen/YulFunctionCache.h>
+
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -35,10 +39,20 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	explicit MultiUseYulFunctionCollector(std::shared_ptr<YulFunctionCache> _cache = nullptr):
+		m_cache(std::move(_cache))
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
+	/// If a cache is set, the function is taken from the cache together with all functions
+	/// @a _creator requested, or stored in the cache after it has been created.
+	/// The code of the function must only depend on its name and the compilation settings.
 	std::string createFunction(std::string const& _name, std::function<std::string()> const& _creator);
+	/// Same as createFunction, but never uses the cache. To be used for functions whose code
+	/// depends on the contract being compiled.
+	std::string createUncachedFunction(std::string const& _name, std::function<std::string()> const& _creator);
 
 	/// @returns concatenation of all generated functions.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -46,8 +60,19 @@ public:
 	std::string requestedFunctions();
 
 private:
+	std::string createFunction(
+		std::string const& _name,
+		std::function<std::string()> const& _creator,
+		bool _useCache
+	);
+	/// Adds the function @a _name and its dependencies from the cache.
+	void addFromCache(std::string const& _name);
+
 	/// Map from function name to code for a multi-use function.
 	std::map<std::string, std::string> m_requestedFunctions;
+	std::shared_ptr<YulFunctionCache> m_cache;
+	/// Names of the functions requested by each of the creators that are currently running.
+	std::vector<std::vector<std::string>> m_dependencies;
 };
 
 }
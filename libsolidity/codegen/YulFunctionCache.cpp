@@ -0,0 +1,50 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Cache of generated Yul helper functions that is shared between all contracts of a compilation.
+ */
+
+#include <libsolidity/codegen/YulFunctionCache.h>
+
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AsmData.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+
+YulFunctionCache::Function const* YulFunctionCache::function(string const& _name) const
+{
+	auto it = m_functions.find(_name);
+	return it == m_functions.end() ? nullptr : &it->second;
+}
+
+void YulFunctionCache::storeFunction(string _name, Function _function)
+{
+	m_functions.emplace(move(_name), move(_function));
+}
+
+YulFunctionCache::ParsedBlock const* YulFunctionCache::parsedBlock(string const& _key) const
+{
+	auto it = m_parsedBlocks.find(_key);
+	return it == m_parsedBlocks.end() ? nullptr : &it->second;
+}
+
+void YulFunctionCache::storeParsedBlock(string _key, ParsedBlock _block)
+{
+	m_parsedBlocks.emplace(move(_key), move(_block));
+}
@@ -0,0 +1,78 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Cache of generated Yul helper functions that is shared between all contracts of a compilation.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace solidity::yul
+{
+struct AsmAnalysisInfo;
+struct Block;
+}
+
+namespace solidity::frontend
+{
+
+/**
+ * Cache of generated Yul helper functions that is shared between all contracts of a compilation.
+ *
+ * The code of the ABI and utility functions only depends on their name and on the settings
+ * of the compilation, so every contract can use the code generated for an earlier one.
+ * Since the names contain the AST IDs of the types involved, the cache must not outlive
+ * the compilation it was created for.
+ *
+ * In addition, the cache stores the parsed, analysed and (if requested) optimised form of
+ * the inline assembly blocks the legacy code generator appends, so that snippets
+ * used by many contracts or many times in one contract are only processed once.
+ */
+class YulFunctionCache
+{
+public:
+	struct Function
+	{
+		std::string code;
+		/// Names of the functions requested while generating the code.
+		std::vector<std::string> dependencies;
+	};
+
+	struct ParsedBlock
+	{
+		std::shared_ptr<yul::Block> code;
+		std::shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
+	};
+
+	/// @returns the function of the given name or nullptr if it has not been generated yet.
+	Function const* function(std::string const& _name) const;
+	void storeFunction(std::string _name, Function _function);
+
+	/// @returns the block stored under @a _key or nullptr if there is none.
+	ParsedBlock const* parsedBlock(std::string const& _key) const;
+	void storeParsedBlock(std::string _key, ParsedBlock _block);
+
+private:
+	std::map<std::string, Function> m_functions;
+	std::map<std::string, ParsedBlock> m_parsedBlocks;
+};
+
+}
@@ -47,10 +47,14 @@ class YulUtilFunctions;
 class IRGenerationContext
 {
 public:
-	IRGenerationContext(langutil::EVMVersion _evmVersion, OptimiserSettings _optimiserSettings):
+	IRGenerationContext(
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<YulFunctionCache> _functionCache = nullptr
+	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(std::move(_optimiserSettings)),
-		m_functions(std::make_shared<MultiUseYulFunctionCollector>())
+		m_functions(std::make_shared<MultiUseYulFunctionCollector>(std::move(_functionCache)))
 	{}
 
 	std::shared_ptr<MultiUseYulFunctionCollector> functionCollector() const { return m_functions; }
@@ -48,9 +48,24 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
 
-pair<string, string> IRGenerator::run(ContractDefinition const& _contract)
+namespace
 {
-	string const ir = yul::reindent(generate(_contract));
+
+string const warning =
+	"/*******************************************************\n"
+	" *                       WARNING                       *\n"
+	" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+	" *       It can result in LOSS OF FUNDS or worse       *\n"
+	" *                !USE AT YOUR OWN RISK!               *\n"
+	" *******************************************************/\n\n";
+
+}
+
+pair<string, shared_ptr<yul::Object>> IRGenerator::run(ContractDefinition const& _contract)
+{
+	// The code is parsed as generated, it is only reindented
+	// if the IR is requested, see formatIR.
+	string const ir = generate(_contract);
 
 	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
 	if (!asmStack.parseAndAnalyze("", ir))
@@ -58,19 +73,21 @@ pair<string, string> IRGenerator::run(ContractDefinition const& _contract)
 		string errorMessage;
 		for (auto const& error: asmStack.errors())
 			errorMessage += langutil::SourceReferenceFormatter::formatErrorInformation(*error);
-		solAssert(false, ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
+		solAssert(false, yul::reindent(ir) + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
 	}
 	asmStack.optimize();
 
-	string warning =
-		"/*******************************************************\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *******************************************************/\n\n";
+	return {ir, asmStack.parserResult()};
+}
 
-	return {warning + ir, warning + asmStack.print()};
+string IRGenerator::formatIR(string const& _ir)
+{
+	return warning + yul::reindent(_ir);
+}
+
+string IRGenerator::formatOptimizedIR(yul::Object const& _object)
+{
+	return warning + _object.toString(false) + "\n";
 }
 
 string IRGenerator::generate(ContractDefinition const& _contract)
@@ -130,7 +147,7 @@ string IRGenerator::generate(Block const& _block)
 string IRGenerator::generateFunction(FunctionDefinition const& _function)
 {
 	string functionName = m_context.functionName(_function);
-	return m_context.functionCollector()->createFunction(functionName, [&]() {
+	return m_context.functionCollector()->createUncachedFunction(functionName, [&]() {
 		Whiskers t(R"(
 			function <functionName>(<params>) <returns> {
 				<body>
@@ -161,7 +178,7 @@ string IRGenerator::generateGetter(VariableDeclaration const& _varDecl)
 
 	solUnimplementedAssert(type->isValueType(), "");
 
-	return m_context.functionCollector()->createFunction(functionName, [&]() {
+	return m_context.functionCollector()->createUncachedFunction(functionName, [&]() {
 		pair<u256, unsigned> slot_offset = m_context.storageLocationOfVariable(_varDecl);
 
 		return Whiskers(R"(
@@ -324,8 +341,10 @@ string IRGenerator::memoryInit()
 	// This function should be called at the beginning of the EVM call frame
 	// and thus can assume all memory to be zero, including the contents of
 	// the "zero memory area" (the position CompilerUtils::zeroPointer points to).
+	// The start of the general purpose area is wrapped in memoryguard, so that the
+	// optimizer can reserve memory for variables that are moved out of the stack.
 	return
-		Whiskers{"mstore(<memPtr>, <generalPurposeStart>)"}
+		Whiskers{"mstore(<memPtr>, memoryguard(<generalPurposeStart>))"}
 		("memPtr", to_string(CompilerUtils::freeMemoryPointer))
 		("generalPurposeStart", to_string(CompilerUtils::generalPurposeMemoryStart))
 		.render();
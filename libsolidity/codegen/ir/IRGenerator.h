@@ -27,8 +27,15 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+
+#include <memory>
 #include <string>
 
+namespace solidity::yul
+{
+struct Object;
+}
+
 namespace solidity::frontend
 {
 
@@ -37,16 +44,26 @@ class SourceUnit;
 class IRGenerator
 {
 public:
-	IRGenerator(langutil::EVMVersion _evmVersion, OptimiserSettings _optimiserSettings):
+	IRGenerator(
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<YulFunctionCache> _functionCache = nullptr
+	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(_optimiserSettings),
-		m_context(_evmVersion, std::move(_optimiserSettings)),
+		m_context(_evmVersion, std::move(_optimiserSettings), std::move(_functionCache)),
 		m_utils(_evmVersion, m_context.functionCollector())
 	{}
 
-	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(ContractDefinition const& _contract);
+	/// Generates the IR code and parses and optimizes it (depending on the optimizer settings).
+	/// @returns the IR code as generated and the optimized Yul object.
+	/// The IR code is not indented, use formatIR to obtain the readable form.
+	std::pair<std::string, std::shared_ptr<yul::Object>> run(ContractDefinition const& _contract);
+
+	/// @returns the readable form of IR code returned by run().
+	static std::string formatIR(std::string const& _ir);
+	/// @returns the textual representation of the optimized Yul object returned by run().
+	static std::string formatOptimizedIR(yul::Object const& _object);
 
 private:
 	std::string generate(ContractDefinition const& _contract);
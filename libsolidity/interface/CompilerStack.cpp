@@ -75,7 +75,7 @@ using namespace solidity::frontend;
 using solidity::util::errinfo_comment;
 using solidity::util::toHex;
 
-static int g_compilerStackCounts = 0;
+static thread_local int g_compilerStackCounts = 0;
 
 CompilerStack::CompilerStack(ReadCallback::Callback const& _readFile):
 	m_readFile{_readFile},
@@ -85,8 +85,8 @@ CompilerStack::CompilerStack(ReadCallback::Callback const& _readFile):
 	m_errorList{},
 	m_errorReporter{m_errorList}
 {
-	// Because TypeProvider is currently a singleton API, we must ensure that
-	// no more than one entity is actually using it at a time.
+	// Because TypeProvider is a per-thread singleton API, we must ensure that
+	// no more than one entity per thread is actually using it at a time.
 	solAssert(g_compilerStackCounts == 0, "You shall not have another CompilerStack aside me.");
 	++g_compilerStackCounts;
 }
@@ -366,12 +366,15 @@ bool CompilerStack::analyze()
 		//
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
-		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
+		//
+		// Every contract is checked by its own type checker into its own error list and the lists
+		// are merged in source order, so that the result does not depend on the order in which
+		// the contracts are processed.
 		for (Source const* source: m_sourceOrder)
 			if (source->ast)
 				for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 					if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
-						if (!typeChecker.checkTypeRequirements(*contract))
+						if (!typeCheckContract(*contract))
 							noErrors = false;
 
 		if (noErrors)
@@ -445,6 +448,33 @@ bool CompilerStack::analyze()
 	return !m_hasError;
 }
 
+bool CompilerStack::typeCheckContract(ContractDefinition const& _contract)
+{
+	// The private list starts with the errors of the earlier stages: the type checker relies on
+	// them in places where it skips a check because another stage already reported the problem.
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	errorReporter.append(m_errorReporter.errors());
+	size_t const previousErrors = errors.size();
+
+	auto mergeErrors = [&]()
+	{
+		m_errorReporter.append(ErrorList(errors.begin() + ptrdiff_t(previousErrors), errors.end()));
+	};
+	bool success = false;
+	try
+	{
+		success = TypeChecker(m_evmVersion, errorReporter).checkTypeRequirements(_contract);
+	}
+	catch (FatalError const&)
+	{
+		mergeErrors();
+		throw;
+	}
+	mergeErrors();
+	return success;
+}
+
 bool CompilerStack::parseAndAnalyze()
 {
 	bool success = parse();
@@ -489,6 +519,7 @@ bool CompilerStack::compile()
 
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	m_yulFunctionCache = make_shared<YulFunctionCache>();
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
@@ -500,6 +531,7 @@ bool CompilerStack::compile()
 					if (m_generateEwasm)
 						generateEwasm(*contract);
 				}
+	m_yulFunctionCache.reset();
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -613,7 +645,12 @@ string const& CompilerStack::yulIR(string const& _contractName) const
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
-	return contract(_contractName).yulIR;
+	Contract const& compiledContract = contract(_contractName);
+	if (!compiledContract.yulIR)
+		compiledContract.yulIR = make_unique<string>(
+			compiledContract.yulIRSource.empty() ? string{} : IRGenerator::formatIR(compiledContract.yulIRSource)
+		);
+	return *compiledContract.yulIR;
 }
 
 string const& CompilerStack::yulIROptimized(string const& _contractName) const
@@ -621,7 +658,12 @@ string const& CompilerStack::yulIROptimized(string const& _contractName) const
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
-	return contract(_contractName).yulIROptimized;
+	Contract const& compiledContract = contract(_contractName);
+	if (!compiledContract.yulIROptimized)
+		compiledContract.yulIROptimized = make_unique<string>(
+			compiledContract.yulIRObject ? IRGenerator::formatOptimizedIR(*compiledContract.yulIRObject) : string{}
+		);
+	return *compiledContract.yulIROptimized;
 }
 
 string const& CompilerStack::ewasm(string const& _contractName) const
@@ -1040,7 +1082,12 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		m_yulFunctionCache
+	);
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(
@@ -1106,14 +1153,14 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	if (!compiledContract.yulIR.empty())
+	if (compiledContract.yulIRObject)
 		return;
 
 	for (auto const* dependency: _contract.annotation().contractDependencies)
 		generateIR(*dependency);
 
-	IRGenerator generator(m_evmVersion, m_optimiserSettings);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract);
+	IRGenerator generator(m_evmVersion, m_optimiserSettings, m_yulFunctionCache);
+	tie(compiledContract.yulIRSource, compiledContract.yulIRObject) = generator.run(_contract);
 }
 
 void CompilerStack::generateEwasm(ContractDefinition const& _contract)
@@ -1123,15 +1170,16 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called generateEwasm with errors."));
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
+	solAssert(compiledContract.yulIRObject, "");
 	if (!compiledContract.ewasm.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
+	// Continue with the Yul IR that has already been optimized in the EVM dialect
+	// instead of printing and re-parsing it.
 	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
+	bool const analysisSuccessful = stack.analyze(compiledContract.yulIRObject);
+	solAssert(analysisSuccessful, "");
 
-	stack.optimize();
 	stack.translate(yul::AssemblyStack::Language::Ewasm);
 	stack.optimize();
 
@@ -1241,6 +1289,13 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 		{
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
+			// Only mention non-default sequences so that existing metadata stays unchanged.
+			if (m_optimiserSettings.yulOptimiserSteps != DefaultYulOptimiserSteps)
+				details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps;
+			if (m_optimiserSettings.yulOptimiserStepBudget > 0)
+				details["yulDetails"]["stepBudget"] = Json::Value(Json::LargestUInt(m_optimiserSettings.yulOptimiserStepBudget));
+			if (m_optimiserSettings.yulOptimiserTimeBudget > 0)
+				details["yulDetails"]["timeBudget"] = Json::Value(Json::LargestUInt(m_optimiserSettings.yulOptimiserTimeBudget));
 		}
 
 		meta["settings"]["optimizer"]["details"] = std::move(details);
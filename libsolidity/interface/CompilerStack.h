@@ -54,6 +54,11 @@ class Scanner;
 }
 
 
+namespace solidity::yul
+{
+struct Object;
+}
+
 namespace solidity::evmasm
 {
 class Assembly;
@@ -73,6 +78,7 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+class YulFunctionCache;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -338,8 +344,8 @@ private:
 		std::shared_ptr<Compiler> compiler;
 		evmasm::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
-		std::string yulIR; ///< Experimental Yul IR code.
-		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		std::string yulIRSource; ///< Experimental Yul IR code as generated, without indentation.
+		std::shared_ptr<yul::Object> yulIRObject; ///< Optimized experimental Yul IR.
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		mutable std::unique_ptr<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -349,6 +355,8 @@ private:
 		mutable std::unique_ptr<Json::Value const> devDocumentation;
 		mutable std::unique_ptr<std::string const> sourceMapping;
 		mutable std::unique_ptr<std::string const> runtimeSourceMapping;
+		mutable std::unique_ptr<std::string const> yulIR; ///< Experimental Yul IR code, formatted on request.
+		mutable std::unique_ptr<std::string const> yulIROptimized; ///< Optimized experimental Yul IR code, printed on request.
 	};
 
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
@@ -357,6 +365,10 @@ private:
 	StringMap loadMissingSources(SourceUnit const& _ast, std::string const& _path);
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	void resolveImports();
+	/// Runs the type checker on a single contract, collecting its errors separately before
+	/// appending them to the global error list.
+	/// @returns false if the contract has type errors.
+	bool typeCheckContract(ContractDefinition const& _contract);
 
 	/// @returns true if the source is requested to be compiled.
 	bool isRequestedSource(std::string const& _sourceName) const;
@@ -440,6 +452,8 @@ private:
 	bool m_generateIR;
 	bool m_generateEwasm;
 	std::map<std::string, util::h160> m_libraries;
+	/// Generated Yul helper functions shared between the contracts, only set during compile().
+	std::shared_ptr<YulFunctionCache> m_yulFunctionCache;
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
 	std::vector<Remapping> m_remappings;
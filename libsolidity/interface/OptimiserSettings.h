@@ -23,10 +23,31 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 
 namespace solidity::frontend
 {
 
+/// Default step sequence of the Yul optimiser. See OptimiserSuite::stepAbbreviationToNameMap()
+/// for the meaning of the letters. A bracketed part is repeated until the code size
+/// does not change anymore.
+constexpr char DefaultYulOptimiserSteps[] =
+	"dhfoDgvufnTUtnIf"            // None of these can make stack problems worse
+	"["
+		"xarrscLM"                // Turn into SSA and simplify
+		"cCTUtTOntnfDIu"          // Perform structural simplification
+		"Lcu"                     // Simplify again
+		"Vcu jj"                  // Reverse SSA
+		// should have good "compilability" property here.
+		"eu"                      // Run functional expression inliner
+		"xaruru"                  // Prune a bit more in SSA
+		"xarrcL"                  // Turn into SSA again and simplify
+		"gFvif"                   // Specialise functions for constant arguments and run full inliner
+		"CTUcarrLsTOtfDncarrIuc"  // SSA plus simplify
+	"]"
+	"jmujuju VcTOcu"              // Make source short and pretty
+	"Qjmu";                       // Remove checks proven by loop conditions and clean up
+
 struct OptimiserSettings
 {
 	/// No optimisations at all - not recommended.
@@ -74,6 +95,9 @@ struct OptimiserSettings
 			runConstantOptimiser == _other.runConstantOptimiser &&
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
+			yulOptimiserSteps == _other.yulOptimiserSteps &&
+			yulOptimiserStepBudget == _other.yulOptimiserStepBudget &&
+			yulOptimiserTimeBudget == _other.yulOptimiserTimeBudget &&
 			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
 	}
 
@@ -95,6 +119,18 @@ struct OptimiserSettings
 	bool optimizeStackAllocation = false;
 	/// Yul optimiser with default settings. Will only run on certain parts of the code for now.
 	bool runYulOptimiser = false;
+	/// Sequence of optimisation steps to be performed by Yul optimiser.
+	/// Note that there are some hard-coded steps in the optimiser and you cannot disable
+	/// them just by setting this to an empty string. Set @a runYulOptimiser to false if you want
+	/// no optimisations.
+	std::string yulOptimiserSteps = DefaultYulOptimiserSteps;
+	/// Maximum number of optimiser steps after which no further round of a repeated
+	/// part of the sequence is started. Zero means no limit.
+	size_t yulOptimiserStepBudget = 0;
+	/// Time in milliseconds after which no further round of a repeated part of the sequence
+	/// is started. Zero means no limit. Note that a non-zero value makes the output depend
+	/// on the speed of the machine.
+	size_t yulOptimiserTimeBudget = 0;
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
@@ -25,6 +25,7 @@
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libyul/AssemblyStack.h>
 #include <libyul/Exceptions.h>
+#include <libyul/optimiser/Suite.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 #include <libevmasm/Instruction.h>
 #include <libsolutil/JSON.h>
@@ -378,6 +379,40 @@ std::optional<Json::Value> checkOptimizerDetail(Json::Value const& _details, std
 	return {};
 }
 
+std::optional<Json::Value> checkYulOptimizerSteps(Json::Value const& _details, std::string const& _name, std::string& _setting)
+{
+	if (_details.isMember(_name))
+	{
+		if (!_details[_name].isString())
+			return formatFatalError("JSONError", "\"settings.optimizer.details.yulDetails." + _name + "\" must be a string");
+
+		try
+		{
+			yul::OptimiserSuite::validateSequence(_details[_name].asString());
+		}
+		catch (yul::OptimizerException const& _exception)
+		{
+			return formatFatalError(
+				"JSONError",
+				"Invalid optimizer step sequence in \"settings.optimizer.details.yulDetails." + _name + "\": " + _exception.what()
+			);
+		}
+		_setting = _details[_name].asString();
+	}
+	return {};
+}
+
+std::optional<Json::Value> checkYulOptimizerBudget(Json::Value const& _details, std::string const& _name, size_t& _setting)
+{
+	if (_details.isMember(_name))
+	{
+		if (!_details[_name].isUInt())
+			return formatFatalError("JSONError", "\"settings.optimizer.details.yulDetails." + _name + "\" must be an unsigned number");
+		_setting = _details[_name].asUInt();
+	}
+	return {};
+}
+
 std::optional<Json::Value> checkMetadataKeys(Json::Value const& _input)
 {
 	if (_input.isObject())
@@ -487,9 +522,16 @@ boost::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Valu
 			if (!settings.runYulOptimiser)
 				return formatFatalError("JSONError", "\"Providing yulDetails requires Yul optimizer to be enabled.");
 
-			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation"}, "settings.optimizer.details.yulDetails"))
+			Json::Value const& yulDetails = details["yulDetails"];
+			if (auto result = checkKeys(yulDetails, {"stackAllocation", "optimizerSteps", "stepBudget", "timeBudget"}, "settings.optimizer.details.yulDetails"))
 				return *result;
-			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackAllocation", settings.optimizeStackAllocation))
+			if (auto error = checkOptimizerDetail(yulDetails, "stackAllocation", settings.optimizeStackAllocation))
+				return *error;
+			if (auto error = checkYulOptimizerSteps(yulDetails, "optimizerSteps", settings.yulOptimiserSteps))
+				return *error;
+			if (auto error = checkYulOptimizerBudget(yulDetails, "stepBudget", settings.yulOptimiserStepBudget))
+				return *error;
+			if (auto error = checkYulOptimizerBudget(yulDetails, "timeBudget", settings.yulOptimiserTimeBudget))
 				return *error;
 		}
 	}
@@ -25,6 +25,7 @@
 #include <libsolidity/ast/AST.h>
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
+#include <libsolutil/Arena.h>
 
 namespace solidity::langutil
 {
@@ -176,6 +177,18 @@ private:
 	/// Returns the next AST node ID
 	int64_t nextID() { return ++m_currentNodeID; }
 
+	/// Creates a new AST node with the next ID inside the arena of the current source unit.
+	template <class NodeType, typename... Args>
+	ASTPointer<NodeType> createNode(langutil::SourceLocation const& _location, Args&& ... _args)
+	{
+		return std::allocate_shared<NodeType>(
+			util::ArenaAllocator<NodeType>(m_arena),
+			nextID(),
+			_location,
+			std::forward<Args>(_args)...
+		);
+	}
+
 	std::pair<LookAheadInfo, IndexAccessedPath> tryParseIndexAccessedPath();
 	/// Performs limited look-ahead to distinguish between variable declaration and expression statement.
 	/// For source code of the form "a[][8]" ("IndexAccessStructure"), this is not possible to
@@ -203,6 +216,9 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// Arena holding the nodes of the source unit currently being parsed.
+	/// Every node keeps it alive, so its lifetime ends with the last reference to the AST.
+	std::shared_ptr<util::Arena> m_arena;
 };
 
 }
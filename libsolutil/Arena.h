@@ -0,0 +1,118 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Bump allocator for objects that share a common lifetime.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Monotonic bump allocator. Memory is handed out from large blocks and is only
+ * released once the arena itself is destroyed.
+ * Not thread-safe.
+ */
+class Arena
+{
+public:
+	explicit Arena(size_t _blockSize = 64 * 1024): m_blockSize(_blockSize) {}
+	Arena(Arena const&) = delete;
+	Arena& operator=(Arena const&) = delete;
+
+	/// @returns uninitialised memory of @a _size bytes. @a _alignment has to be a power of two.
+	void* allocate(size_t _size, size_t _alignment)
+	{
+		uintptr_t aligned = (m_current + _alignment - 1) & ~uintptr_t(_alignment - 1);
+		if (m_current == 0 || aligned + _size > m_end)
+		{
+			// Oversized requests get a block of their own so that the current block is not wasted.
+			if (_size + _alignment > m_blockSize / 4)
+			{
+				m_bytesAllocated += _size;
+				return alignedPointer(newBlock(_size + _alignment), _alignment);
+			}
+			m_current = newBlock(m_blockSize);
+			m_end = m_current + m_blockSize;
+			aligned = (m_current + _alignment - 1) & ~uintptr_t(_alignment - 1);
+		}
+		m_current = aligned + _size;
+		m_bytesAllocated += _size;
+		return reinterpret_cast<void*>(aligned);
+	}
+
+	/// @returns the number of bytes handed out so far, excluding alignment padding.
+	size_t bytesAllocated() const { return m_bytesAllocated; }
+	/// @returns the number of bytes reserved from the system.
+	size_t bytesReserved() const { return m_bytesReserved; }
+
+private:
+	uintptr_t newBlock(size_t _size)
+	{
+		m_blocks.emplace_back(new char[_size]);
+		m_bytesReserved += _size;
+		return reinterpret_cast<uintptr_t>(m_blocks.back().get());
+	}
+	void* alignedPointer(uintptr_t _address, size_t _alignment)
+	{
+		return reinterpret_cast<void*>((_address + _alignment - 1) & ~uintptr_t(_alignment - 1));
+	}
+
+	size_t m_blockSize;
+	uintptr_t m_current = 0;
+	uintptr_t m_end = 0;
+	size_t m_bytesAllocated = 0;
+	size_t m_bytesReserved = 0;
+	std::vector<std::unique_ptr<char[]>> m_blocks;
+};
+
+/**
+ * Standard allocator backed by an Arena. Every copy of the allocator keeps the arena alive,
+ * so objects created via std::allocate_shared keep their memory valid for as long
+ * as they are referenced. Deallocation is a no-op.
+ */
+template <class T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ArenaAllocator(std::shared_ptr<Arena> _arena): m_arena(std::move(_arena)) {}
+	template <class U>
+	ArenaAllocator(ArenaAllocator<U> const& _other): m_arena(_other.arena()) {}
+
+	T* allocate(size_t _n) { return static_cast<T*>(m_arena->allocate(_n * sizeof(T), alignof(T))); }
+	void deallocate(T*, size_t) noexcept {}
+
+	std::shared_ptr<Arena> const& arena() const { return m_arena; }
+
+	template <class U>
+	bool operator==(ArenaAllocator<U> const& _other) const { return m_arena == _other.arena(); }
+	template <class U>
+	bool operator!=(ArenaAllocator<U> const& _other) const { return m_arena != _other.arena(); }
+
+private:
+	std::shared_ptr<Arena> m_arena;
+};
+
+}
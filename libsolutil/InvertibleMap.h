@@ -18,10 +18,16 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <set>
+#include <vector>
 
 /**
  * Data structure that keeps track of values and keys of a mapping.
+ *
+ * Supports nested checkpoints: After pushCheckpoint(), the previous value of every
+ * modified key is recorded, so that joinWithCheckpoint() can intersect the current state with
+ * the state at the checkpoint in time proportional to the number of modified keys.
  */
 template <class K, class V>
 struct InvertibleMap
@@ -29,9 +35,13 @@ struct InvertibleMap
 	std::map<K, V> values;
 	// references[x] == {y | values[y] == x}
 	std::map<V, std::set<K>> references;
+	/// For each open checkpoint, the values the modified keys had at the checkpoint
+	/// (nullopt if the key did not exist).
+	std::vector<std::map<K, std::optional<V>>> checkpoints;
 
 	void set(K _key, V _value)
 	{
+		recordChange(_key);
 		if (values.count(_key))
 			references[values[_key]].erase(_key);
 		values[_key] = _value;
@@ -41,7 +51,10 @@ struct InvertibleMap
 	void eraseKey(K _key)
 	{
 		if (values.count(_key))
+		{
+			recordChange(_key);
 			references[values[_key]].erase(_key);
+		}
 		values.erase(_key);
 	}
 
@@ -50,16 +63,54 @@ struct InvertibleMap
 		if (references.count(_value))
 		{
 			for (V v: references[_value])
+			{
+				recordChange(v);
 				values.erase(v);
+			}
 			references.erase(_value);
 		}
 	}
 
 	void clear()
 	{
+		if (!checkpoints.empty())
+			for (auto const& item: values)
+				recordChange(item.first);
 		values.clear();
 		references.clear();
 	}
+
+	void pushCheckpoint()
+	{
+		checkpoints.emplace_back();
+	}
+
+	/// Removes the innermost checkpoint and all keys whose current value differs from the value
+	/// they had at that checkpoint. The remaining entries are those that are equal in both states.
+	/// Requires an open checkpoint.
+	void joinWithCheckpoint()
+	{
+		std::map<K, std::optional<V>> changes = std::move(checkpoints.back());
+		checkpoints.pop_back();
+		// Keys that were already modified before the inner checkpoint keep their older value.
+		if (!checkpoints.empty())
+			checkpoints.back().insert(changes.begin(), changes.end());
+		for (auto const& [key, oldValue]: changes)
+		{
+			auto it = values.find(key);
+			if (it != values.end() && (!oldValue || *oldValue != it->second))
+				eraseKey(key);
+		}
+	}
+
+private:
+	void recordChange(K const& _key)
+	{
+		if (checkpoints.empty())
+			return;
+		auto it = values.find(_key);
+		checkpoints.back().emplace(_key, it == values.end() ? std::optional<V>{} : std::optional<V>{it->second});
+	}
 };
 
 template <class T>
@@ -25,13 +25,59 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <algorithm>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
 
+struct Whiskers::Template
+{
+	enum class Kind { Text, Parameter, List, Condition };
+	struct Element
+	{
+		Kind kind = Kind::Text;
+		/// The text for text elements and the name of the parameter otherwise.
+		string value;
+		/// Repeated part of lists and first part of conditions.
+		unique_ptr<Template> body;
+		/// Part of conditions after ``<!name>``, null if there is none.
+		unique_ptr<Template> elseBody;
+	};
+
+	/// Text the template was parsed from, used in error messages.
+	string source;
+	vector<Element> elements;
+};
+
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the length of the parameter name at @a _pos in @a _source if it is followed by ``>``
+/// and zero otherwise.
+size_t parameterLength(string const& _source, size_t _pos)
+{
+	size_t end = _pos;
+	while (end < _source.size() && isParameterCharacter(_source[end]))
+		++end;
+	if (end == _pos || end == _source.size() || _source[end] != '>')
+		return 0;
+	return end - _pos;
+}
+
+}
+
 Whiskers::Whiskers(string _template):
-	m_template(move(_template))
+	m_template(parse(move(_template)))
 {
 }
 
@@ -67,14 +113,19 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	size_t size = m_template->source.size();
+	for (auto const& parameter: m_parameters)
+		size += parameter.second.size();
+	string result;
+	result.reserve(size);
+	render(result, *m_template, m_parameters, nullptr, m_conditions, m_listParameters);
+	return result;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && all_of(_parameter.begin(), _parameter.end(), isParameterCharacter),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -99,97 +150,154 @@ void Whiskers::checkParameterUnknown(string const& _parameter) const
 	);
 }
 
-namespace
+shared_ptr<Whiskers::Template const> Whiskers::parse(string _template)
 {
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
+	static unordered_map<string, shared_ptr<Template const>> cache;
+	auto it = cache.find(_template);
+	if (it != cache.end())
+		return it->second;
+	shared_ptr<Template const> parsed = parseTemplate(_template);
+	cache.emplace(move(_template), parsed);
+	return parsed;
+}
+
+unique_ptr<Whiskers::Template> Whiskers::parseTemplate(string _source)
 {
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
+	// Tags are searched from left to right. A list or condition ends at the first
+	// closing tag of the same name. Anything that is not a complete tag is copied verbatim.
+	auto result = make_unique<Template>();
+	auto addText = [&](size_t _begin, size_t _end)
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
+		if (_begin < _end)
+			result->elements.push_back({Template::Kind::Text, _source.substr(_begin, _end - _begin), {}, {}});
+	};
+
+	size_t textStart = 0;
+	size_t pos = 0;
+	while ((pos = _source.find('<', pos)) != string::npos)
+	{
+		Template::Element element;
+		size_t next = string::npos;
+		if (size_t length = parameterLength(_source, pos + 1))
+		{
+			element.kind = Template::Kind::Parameter;
+			element.value = _source.substr(pos + 1, length);
+			next = pos + length + 2;
+		}
+		else if (pos + 1 < _source.size() && (_source[pos + 1] == '#' || _source[pos + 1] == '?'))
+			if (size_t length = parameterLength(_source, pos + 2))
+			{
+				element.value = _source.substr(pos + 2, length);
+				size_t bodyStart = pos + length + 3;
+				string closingTag = "</" + element.value + ">";
+				size_t bodyEnd = _source.find(closingTag, bodyStart);
+				if (bodyEnd != string::npos)
+				{
+					next = bodyEnd + closingTag.size();
+					if (_source[pos + 1] == '#')
+					{
+						element.kind = Template::Kind::List;
+						element.body = parseTemplate(_source.substr(bodyStart, bodyEnd - bodyStart));
+					}
+					else
+					{
+						element.kind = Template::Kind::Condition;
+						string elseTag = "<!" + element.value + ">";
+						size_t elsePos = _source.find(elseTag, bodyStart);
+						if (elsePos < bodyEnd)
+						{
+							element.body = parseTemplate(_source.substr(bodyStart, elsePos - bodyStart));
+							size_t elseStart = elsePos + elseTag.size();
+							element.elseBody = parseTemplate(_source.substr(elseStart, bodyEnd - elseStart));
+						}
+						else
+							element.body = parseTemplate(_source.substr(bodyStart, bodyEnd - bodyStart));
+					}
+				}
+			}
+
+		if (next == string::npos)
+		{
+			++pos;
+			continue;
+		}
+		addText(textStart, pos);
+		result->elements.emplace_back(move(element));
+		pos = textStart = next;
 	}
-	result.append(lastMatchedPos, _source.cend());
+	addText(textStart, _source.size());
+	result->source = move(_source);
 	return result;
 }
-}
 
-string Whiskers::replace(
-	string const& _template,
+void Whiskers::render(
+	string& _output,
+	Template const& _template,
 	StringMap const& _parameters,
+	StringMap const* _listElement,
 	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
+	StringListMap const& _listParameters
 )
 {
-	static regex listOrTag("<(" + paramRegex() + ")>|<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|<\\?(" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>");
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
+	for (auto const& element: _template.elements)
+		switch (element.kind)
+		{
+		case Template::Kind::Text:
+			_output += element.value;
+			break;
+		case Template::Kind::Parameter:
 		{
+			if (_listElement)
+			{
+				auto it = _listElement->find(element.value);
+				if (it != _listElement->end())
+				{
+					_output += it->second;
+					break;
+				}
+			}
+			auto it = _parameters.find(element.value);
 			assertThrow(
-				_parameters.count(tagName),
+				it != _parameters.end(),
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + element.value + " not provided.\n" +
 				"Template:\n" +
-				_template
+				_template.source
 			);
-			return _parameters.at(tagName);
+			_output += it->second;
+			break;
 		}
-		else if (!listName.empty())
+		case Template::Kind::List:
 		{
-			string templ(_match[3]);
+			auto it = _listParameters.find(element.value);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				it != _listParameters.end(),
+				WhiskersError, "List parameter " + element.value + " not set."
 			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			for (auto const& listElement: it->second)
+			{
+				for (auto const& parameter: listElement)
+					assertThrow(
+						!_parameters.count(parameter.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				render(_output, *element.body, _parameters, &listElement, _conditions, {});
+			}
+			break;
 		}
-		else
+		case Template::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
+			auto it = _conditions.find(element.value);
 			assertThrow(
-				_conditions.count(conditionName),
-				WhiskersError, "Condition parameter " + conditionName + " not set."
-			);
-			return replace(
-				_conditions.at(conditionName) ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
+				it != _conditions.end(),
+				WhiskersError, "Condition parameter " + element.value + " not set."
 			);
+			if (it->second)
+				render(_output, *element.body, _parameters, _listElement, _conditions, _listParameters);
+			else if (element.elseBody)
+				render(_output, *element.elseBody, _parameters, _listElement, _conditions, _listParameters);
+			break;
+		}
 		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
 }
-
@@ -27,6 +27,7 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace solidity::util
@@ -62,6 +63,9 @@ DEV_SIMPLE_EXCEPTION(WhiskersError);
  *  - List parameter: <#list>...</list>
  *    The part between the tags is repeated as often as values are provided
  *    in the mapping. Each list element can have its own parameter -> value mapping.
+ *
+ * Every distinct template text is only parsed once, the parsed form is cached
+ * and shared between all Whiskers objects with the same template text.
  */
 class Whiskers
 {
@@ -85,24 +89,30 @@ public:
 	std::string render() const;
 
 private:
+	/// Template text parsed into a sequence of text, parameters, lists and conditions.
+	struct Template;
+
 	// Prevent implicit cast to bool
 	Whiskers& operator()(std::string _parameter, long long);
 	void checkParameterValid(std::string const& _parameter) const;
 	void checkParameterUnknown(std::string const& _parameter) const;
 
-	static std::string replace(
-		std::string const& _template,
+	/// @returns the parsed form of @a _template, which is taken from the cache if possible.
+	static std::shared_ptr<Template const> parse(std::string _template);
+	static std::unique_ptr<Template> parseTemplate(std::string _source);
+
+	/// Appends the rendered @a _template to @a _output. Parameters are looked up in
+	/// @a _listElement (if provided) and then in @a _parameters.
+	static void render(
+		std::string& _output,
+		Template const& _template,
 		StringMap const& _parameters,
+		StringMap const* _listElement,
 		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
+		StringListMap const& _listParameters
 	);
 
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
-
-	std::string m_template;
+	std::shared_ptr<Template const> m_template;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
 	StringListMap m_listParameters;
@@ -325,6 +325,14 @@ bool AsmAnalyzer::operator()(FunctionCall const& _funCall)
 					_funCall.functionName.location,
 					"Function expects direct literals as arguments."
 				);
+			else if (_funCall.functionName.name == "memoryguard"_yulstring)
+			{
+				if (std::get<Literal>(arg).kind != LiteralKind::Number)
+					m_errorReporter.typeError(
+						_funCall.functionName.location,
+						"Function expects a number literal as argument."
+					);
+			}
 			else if (!m_dataNames.count(std::get<Literal>(arg).value))
 				m_errorReporter.typeError(
 					_funCall.functionName.location,
@@ -90,6 +90,18 @@ bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string
 	return analyzeParsed();
 }
 
+bool AssemblyStack::analyze(shared_ptr<Object> _object)
+{
+	m_errors.clear();
+	m_analysisSuccessful = false;
+	m_scanner.reset();
+	m_parserResult = std::move(_object);
+	yulAssert(m_parserResult, "");
+	yulAssert(m_parserResult->code, "");
+
+	return analyzeParsed();
+}
+
 void AssemblyStack::optimize()
 {
 	if (!m_optimiserSettings.runYulOptimiser)
@@ -113,9 +125,9 @@ void AssemblyStack::translate(AssemblyStack::Language _targetLanguage)
 		"Invalid language combination"
 	);
 
-	*m_parserResult = EVMToEwasmTranslator(
+	m_parserResult = make_shared<Object>(EVMToEwasmTranslator(
 		languageToDialect(m_language, m_evmVersion)
-	).run(*parserResult());
+	).run(*parserResult()));
 
 	m_language = _targetLanguage;
 }
@@ -183,7 +195,12 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		dialect,
 		meter.get(),
 		_object,
-		m_optimiserSettings.optimizeStackAllocation
+		m_optimiserSettings.optimizeStackAllocation,
+		m_optimiserSettings.yulOptimiserSteps,
+		{
+			m_optimiserSettings.yulOptimiserStepBudget,
+			chrono::milliseconds(m_optimiserSettings.yulOptimiserTimeBudget)
+		}
 	);
 }
 
@@ -77,6 +77,13 @@ public:
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
 
+	/// Runs the analysis step on an object that was not parsed by this assembly stack,
+	/// for example one that was optimized by another assembly stack. The object is shared,
+	/// so it is modified by optimize(), but not by translate().
+	/// Multiple calls overwrite the previous state.
+	/// @returns false if the object is invalid.
+	bool analyze(std::shared_ptr<Object> _object);
+
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
 	void optimize();
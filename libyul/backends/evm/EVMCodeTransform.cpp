@@ -173,16 +173,36 @@ void CodeTransform::deleteVariable(Scope::Variable const& _var)
 	m_variablesScheduledForDeletion.erase(&_var);
 }
 
+bool CodeTransform::canConsumeVariable(YulString _name, Scope::Variable const& _var) const
+{
+	if (!m_allowStackOpt || m_insideForLoopCondition)
+		return false;
+	auto identifier = m_scope->identifiers.find(_name);
+	if (
+		identifier == m_scope->identifiers.end() ||
+		!holds_alternative<Scope::Variable>(identifier->second) ||
+		&std::get<Scope::Variable>(identifier->second) != &_var
+	)
+		return false;
+	// An unused slot right below would end up on top of the stack, where it could be
+	// popped inside a nested block that is not executed on all paths.
+	int height = m_context->variableStackHeights.at(&_var);
+	return
+		m_context->variableReferences.at(&_var) == 1 &&
+		height == m_assembly.stackHeight() - 1 &&
+		!m_unusedStackSlots.count(height - 1);
+}
+
 void CodeTransform::operator()(VariableDeclaration const& _varDecl)
 {
 	yulAssert(m_scope, "");
 
 	int const numVariables = _varDecl.variables.size();
-	int height = m_assembly.stackHeight();
 	if (_varDecl.value)
 	{
+		int heightInAnalysis = m_assembly.stackHeight() - m_stackAdjustment;
 		std::visit(*this, *_varDecl.value);
-		expectDeposit(numVariables, height);
+		expectDeposit(numVariables, heightInAnalysis);
 	}
 	else
 	{
@@ -190,6 +210,9 @@ void CodeTransform::operator()(VariableDeclaration const& _varDecl)
 		while (variablesLeft--)
 			m_assembly.appendConstant(u256(0));
 	}
+	// Not necessarily the height before the value was evaluated, because the value
+	// might have consumed the stack slot of a variable.
+	int height = m_assembly.stackHeight() - numVariables;
 
 	bool atTopOfStack = true;
 	for (int varIndex = numVariables - 1; varIndex >= 0; --varIndex)
@@ -243,9 +266,9 @@ void CodeTransform::stackError(StackTooDeepError _error, int _targetStackHeight)
 
 void CodeTransform::operator()(Assignment const& _assignment)
 {
-	int height = m_assembly.stackHeight();
+	int heightInAnalysis = m_assembly.stackHeight() - m_stackAdjustment;
 	std::visit(*this, *_assignment.value);
-	expectDeposit(_assignment.variableNames.size(), height);
+	expectDeposit(_assignment.variableNames.size(), heightInAnalysis);
 
 	m_assembly.setSourceLocation(_assignment.location);
 	generateMultiAssignment(_assignment.variableNames);
@@ -312,8 +335,15 @@ void CodeTransform::operator()(Identifier const& _identifier)
 	if (m_scope->lookup(_identifier.name, GenericVisitor{
 		[=](Scope::Variable& _var)
 		{
-			// TODO: opportunity for optimization: Do not DUP if this is the last reference
-			// to the top most element of the stack
+			if (canConsumeVariable(_identifier.name, _var))
+			{
+				// Use the value in place instead of a copy. The slot now belongs to the
+				// expression, so the variable is gone without a POP.
+				m_context->variableStackHeights.erase(&_var);
+				m_context->variableReferences.erase(&_var);
+				--m_stackAdjustment;
+				return;
+			}
 			if (int heightDiff = variableHeightDiff(_var, _identifier.name, false))
 				m_assembly.appendInstruction(evmasm::dupInstruction(heightDiff));
 			else
@@ -548,7 +578,9 @@ void CodeTransform::operator()(ForLoop const& _forLoop)
 	m_assembly.setSourceLocation(_forLoop.location);
 	m_assembly.appendLabel(loopStart);
 
+	m_insideForLoopCondition = true;
 	visitExpression(*_forLoop.condition);
+	m_insideForLoopCondition = false;
 	m_assembly.setSourceLocation(_forLoop.location);
 	m_assembly.appendInstruction(evmasm::Instruction::ISZERO);
 	m_assembly.appendJumpToIf(loopEnd);
@@ -643,9 +675,9 @@ AbstractAssembly::LabelID CodeTransform::functionEntryID(YulString _name, Scope:
 
 void CodeTransform::visitExpression(Expression const& _expression)
 {
-	int height = m_assembly.stackHeight();
+	int heightInAnalysis = m_assembly.stackHeight() - m_stackAdjustment;
 	std::visit(*this, _expression);
-	expectDeposit(1, height);
+	expectDeposit(1, heightInAnalysis);
 }
 
 void CodeTransform::visitStatements(vector<Statement> const& _statements)
@@ -755,7 +787,7 @@ int CodeTransform::variableHeightDiff(Scope::Variable const& _var, YulString _va
 
 void CodeTransform::expectDeposit(int _deposit, int _oldHeight) const
 {
-	yulAssert(m_assembly.stackHeight() == _oldHeight + _deposit, "Invalid stack deposit.");
+	yulAssert(m_assembly.stackHeight() - m_stackAdjustment == _oldHeight + _deposit, "Invalid stack deposit.");
 }
 
 void CodeTransform::checkStackHeight(void const* _astElement) const
@@ -167,6 +167,11 @@ protected:
 	void freeUnusedVariables();
 	/// Marks the stack slot of @a _var to be reused.
 	void deleteVariable(Scope::Variable const& _var);
+	/// @returns true if the reference to @a _var is its last one, the variable is on top of
+	/// the stack, the slot below it is in use and it was defined in the current scope.
+	/// In that case, its stack slot can be consumed instead of a copy, because no other
+	/// control-flow path needs it anymore.
+	bool canConsumeVariable(YulString _name, Scope::Variable const& _var) const;
 
 public:
 	void operator()(Literal const& _literal);
@@ -204,6 +209,8 @@ private:
 	/// the (positive) stack height difference otherwise.
 	int variableHeightDiff(Scope::Variable const& _var, YulString _name, bool _forSwap);
 
+	/// Asserts that the stack height as determined during the analysis phase changed
+	/// by @a _deposit since it was @a _oldHeight.
 	void expectDeposit(int _deposit, int _oldHeight) const;
 
 	void checkStackHeight(void const* _astElement) const;
@@ -237,6 +244,8 @@ private:
 	/// statement level in the scope where the variable was defined.
 	std::set<Scope::Variable const*> m_variablesScheduledForDeletion;
 	std::set<int> m_unusedStackSlots;
+	/// True while generating code for the condition of a for loop, which is evaluated repeatedly.
+	bool m_insideForLoopCondition = false;
 
 	std::vector<StackTooDeepError> m_stackErrors;
 };
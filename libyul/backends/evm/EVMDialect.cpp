@@ -24,6 +24,7 @@
 #include <libyul/AsmData.h>
 #include <libyul/Object.h>
 #include <libyul/Exceptions.h>
+#include <libyul/Utilities.h>
 #include <libyul/AsmParser.h>
 #include <libyul/backends/evm/AbstractAssembly.h>
 
@@ -147,6 +148,17 @@ map<YulString, BuiltinFunctionForEVM> createBuiltins(langutil::EVMVersion _evmVe
 				_assembly.appendDataOffset(_context.subIDs.at(dataName));
 			}
 		}));
+		builtins.emplace(createFunction("memoryguard", 1, 1, SideEffects{}, true, [](
+			FunctionCall const& _call,
+			AbstractAssembly& _assembly,
+			BuiltinContext&,
+			std::function<void()>
+		) {
+			yulAssert(_call.arguments.size() == 1, "");
+			Literal const* literal = get_if<Literal>(&_call.arguments.front());
+			yulAssert(literal, "");
+			_assembly.appendConstant(valueOfLiteral(*literal));
+		}));
 		builtins.emplace(createFunction(
 			"datacopy",
 			3,
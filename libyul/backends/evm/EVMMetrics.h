@@ -51,6 +51,9 @@ public:
 	/// the costs for its arguments.
 	size_t instructionCosts(evmasm::Instruction _instruction) const;
 
+	/// @returns the number of expected executions per deployment the costs are weighted with.
+	size_t runs() const { return m_runs; }
+
 private:
 	size_t combineCosts(std::pair<size_t, size_t> _costs) const;
 
@@ -30,6 +30,7 @@
 #include <libyul/optimiser/NameDisplacer.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/ForLoopConditionIntoBody.h>
+#include <libyul/optimiser/ASTWalker.h>
 
 #include <libyul/AsmParser.h>
 #include <libyul/AsmAnalysis.h>
@@ -791,6 +792,26 @@ function invalid() {
 }
 })"};
 
+/**
+ * Replaces calls to ``memoryguard`` by their argument. Memory spilling of stack variables
+ * is only done for EVM, so the reserved area is always empty here.
+ */
+class MemoryGuardRemover: public ASTModifier
+{
+public:
+	void visit(Expression& _expression) override
+	{
+		ASTModifier::visit(_expression);
+		if (FunctionCall* call = get_if<FunctionCall>(&_expression))
+			if (call->functionName.name == "memoryguard"_yulstring)
+			{
+				yulAssert(call->arguments.size() == 1, "");
+				Expression argument = std::move(call->arguments.front());
+				_expression = std::move(argument);
+			}
+	}
+};
+
 }
 
 Object EVMToEwasmTranslator::run(Object const& _object)
@@ -806,6 +827,7 @@ Object EVMToEwasmTranslator::run(Object const& _object)
 	FunctionHoister::run(context, ast);
 	FunctionGrouper::run(context, ast);
 	MainFunction{}(ast);
+	MemoryGuardRemover{}(ast);
 	ForLoopConditionIntoBody::run(context, ast);
 	ExpressionSplitter::run(context, ast);
 	WordSizeTransform::run(m_dialect, ast, nameDispenser);
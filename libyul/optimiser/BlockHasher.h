@@ -15,7 +15,7 @@
 	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
 */
 /**
- * Optimiser component that calculates hash values for blocks.
+ * Optimiser components that calculate hash values for blocks and expressions.
  */
 #pragma once
 
@@ -27,6 +27,41 @@
 namespace solidity::yul
 {
 
+/**
+ * Functionality shared by the hashers below: an FNV-1a hash that is built up
+ * step by step.
+ */
+class ASTHasherBase
+{
+public:
+	static constexpr uint64_t fnvPrime = 1099511628211u;
+	static constexpr uint64_t fnvEmptyHash = 14695981039346656037u;
+
+protected:
+	void hash8(uint8_t _value)
+	{
+		m_hash *= fnvPrime;
+		m_hash ^= _value;
+	}
+	void hash16(uint16_t _value)
+	{
+		hash8(static_cast<uint8_t>(_value & 0xFF));
+		hash8(static_cast<uint8_t>(_value >> 8));
+	}
+	void hash32(uint32_t _value)
+	{
+		hash16(static_cast<uint16_t>(_value & 0xFFFF));
+		hash16(static_cast<uint16_t>(_value >> 16));
+	}
+	void hash64(uint64_t _value)
+	{
+		hash32(static_cast<uint32_t>(_value & 0xFFFFFFFF));
+		hash32(static_cast<uint32_t>(_value >> 32));
+	}
+
+	uint64_t m_hash = fnvEmptyHash;
+};
+
 /**
  * Optimiser component that calculates hash values for blocks.
  * Syntactically equal blocks will have identical hashes and
@@ -41,7 +76,7 @@ namespace solidity::yul
  *
  * Prerequisite: Disambiguator, ForLoopInitRewriter
  */
-class BlockHasher: public ASTWalker
+class BlockHasher: public ASTWalker, public ASTHasherBase
 {
 public:
 
@@ -64,36 +99,11 @@ public:
 
 	static std::map<Block const*, uint64_t> run(Block const& _block);
 
-	static constexpr uint64_t fnvPrime = 1099511628211u;
-	static constexpr uint64_t fnvEmptyHash = 14695981039346656037u;
-
 private:
 	BlockHasher(std::map<Block const*, uint64_t>& _blockHashes): m_blockHashes(_blockHashes) {}
 
-	void hash8(uint8_t _value)
-	{
-		m_hash *= fnvPrime;
-		m_hash ^= _value;
-	}
-	void hash16(uint16_t _value)
-	{
-		hash8(static_cast<uint8_t>(_value & 0xFF));
-		hash8(static_cast<uint8_t>(_value >> 8));
-	}
-	void hash32(uint32_t _value)
-	{
-		hash16(static_cast<uint16_t>(_value & 0xFFFF));
-		hash16(static_cast<uint16_t>(_value >> 16));
-	}
-	void hash64(uint64_t _value)
-	{
-		hash32(static_cast<uint32_t>(_value & 0xFFFFFFFF));
-		hash32(static_cast<uint32_t>(_value >> 32));
-	}
-
 	std::map<Block const*, uint64_t>& m_blockHashes;
 
-	uint64_t m_hash = fnvEmptyHash;
 	struct VariableReference
 	{
 		size_t id = 0;
@@ -105,5 +115,27 @@ private:
 	size_t m_internalIdentifierCount = 0;
 };
 
+/**
+ * Optimiser component that calculates hash values for expressions.
+ * Syntactically equal expressions will have identical hashes and
+ * expressions with equal hashes will likely be syntactically equal.
+ *
+ * In contrast to the BlockHasher, the names of referenced variables
+ * are taken into account, since expressions do not declare variables.
+ * Number literals are hashed by their value, so ``0x20`` and ``32``
+ * have the same hash.
+ */
+class ExpressionHasher: public ASTWalker, public ASTHasherBase
+{
+public:
+	using ASTWalker::operator();
+
+	void operator()(Literal const&) override;
+	void operator()(Identifier const&) override;
+	void operator()(FunctionCall const& _funCall) override;
+
+	static uint64_t run(Expression const& _expression);
+};
+
 
 }
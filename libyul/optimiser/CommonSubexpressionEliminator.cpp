@@ -21,6 +21,7 @@
 
 #include <libyul/optimiser/CommonSubexpressionEliminator.h>
 
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
@@ -90,12 +91,18 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 	}
 	else
 	{
-		// TODO this search is rather inefficient.
-		for (auto const& [variable, value]: m_value)
+		auto candidates = m_replacementCandidates.find(ExpressionHasher::run(_e));
+		if (candidates == m_replacementCandidates.end())
+			return;
+		for (YulString variable: candidates->second)
 		{
-			assertThrow(value.value, OptimizerException, "");
+			// The candidate might have been assigned a different value since.
+			auto value = m_value.find(variable);
+			if (value == m_value.end())
+				continue;
+			assertThrow(value->second.value, OptimizerException, "");
 			assertThrow(inScope(variable), OptimizerException, "");
-			if (SyntacticallyEqual{}(_e, *value.value))
+			if (SyntacticallyEqual{}(_e, *value->second.value))
 			{
 				_e = Identifier{locationOf(_e), variable};
 				break;
@@ -103,3 +110,10 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 		}
 	}
 }
+
+void CommonSubexpressionEliminator::assignValue(YulString _variable, Expression const* _value)
+{
+	if (_value)
+		m_replacementCandidates[ExpressionHasher::run(*_value)].insert(_variable);
+	DataFlowAnalyzer::assignValue(_variable, _value);
+}
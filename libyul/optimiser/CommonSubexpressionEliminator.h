@@ -34,6 +34,11 @@ struct SideEffects;
  * Optimisation stage that replaces expressions known to be the current value of a variable
  * in scope by a reference to that variable.
  *
+ * The candidates for an expression are looked up by the hash of the expression in an index
+ * that is updated whenever a variable is assigned. Entries are not removed when the value of
+ * a variable is cleared, but every candidate is checked against the current value of the
+ * variable, which also takes care of hash collisions.
+ *
  * Prerequisite: Disambiguator, ForLoopInitRewriter.
  */
 class CommonSubexpressionEliminator: public DataFlowAnalyzer
@@ -51,6 +56,12 @@ private:
 protected:
 	using ASTModifier::visit;
 	void visit(Expression& _e) override;
+
+	void assignValue(YulString _variable, Expression const* _value) override;
+
+private:
+	/// Variables that were assigned a value with the given hash at some point.
+	std::map<uint64_t, std::set<YulString>> m_replacementCandidates;
 };
 
 }
@@ -104,12 +104,11 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 void DataFlowAnalyzer::operator()(If& _if)
 {
 	clearKnowledgeIfInvalidated(*_if.condition);
-	InvertibleMap<YulString, YulString> storage = m_storage;
-	InvertibleMap<YulString, YulString> memory = m_memory;
+	pushKnowledgeCheckpoint();
 
 	ASTModifier::operator()(_if);
 
-	joinKnowledge(storage, memory);
+	joinKnowledge();
 
 	Assignments assignments;
 	assignments(_if.body);
@@ -123,10 +122,9 @@ void DataFlowAnalyzer::operator()(Switch& _switch)
 	set<YulString> assignedVariables;
 	for (auto& _case: _switch.cases)
 	{
-		InvertibleMap<YulString, YulString> storage = m_storage;
-		InvertibleMap<YulString, YulString> memory = m_memory;
+		pushKnowledgeCheckpoint();
 		(*this)(_case.body);
-		joinKnowledge(storage, memory);
+		joinKnowledge();
 
 		Assignments assignments;
 		assignments(_case.body);
@@ -298,8 +296,12 @@ void DataFlowAnalyzer::clearValues(set<YulString> _variables)
 
 	// Also clear variables that reference variables to be cleared.
 	for (auto const& name: _variables)
-		for (auto const& ref: m_references.backward[name])
-			_variables.emplace(ref);
+	{
+		auto it = m_references.backward.find(name);
+		if (it != m_references.backward.end())
+			for (auto const& ref: it->second)
+				_variables.emplace(ref);
+	}
 
 	// Clear the value and update the reference relation.
 	for (auto const& name: _variables)
@@ -324,6 +326,24 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 {
+	// For calls to user-defined functions with simple arguments, only the written locations
+	// have to be cleared.
+	if (holds_alternative<FunctionCall>(_expr))
+	{
+		FunctionCall const& funCall = std::get<FunctionCall>(_expr);
+		auto locations = m_functionStoreLocations.find(funCall.functionName.name);
+		if (
+			locations != m_functionStoreLocations.end() &&
+			all_of(funCall.arguments.begin(), funCall.arguments.end(), [](Expression const& _arg) {
+				return holds_alternative<Identifier>(_arg) || holds_alternative<Literal>(_arg);
+			})
+		)
+		{
+			clearKnowledgeAbout(locations->second);
+			return;
+		}
+	}
+
 	SideEffectsCollector sideEffects(m_dialect, _expr, &m_functionSideEffects);
 	if (sideEffects.invalidatesStorage())
 		m_storage.clear();
@@ -331,33 +351,56 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 		m_memory.clear();
 }
 
-void DataFlowAnalyzer::joinKnowledge(
-	InvertibleMap<YulString, YulString> const& _olderStorage,
-	InvertibleMap<YulString, YulString> const& _olderMemory
-)
+void DataFlowAnalyzer::clearKnowledgeAbout(StoreLocations const& _locations)
 {
-	joinKnowledgeHelper(m_storage, _olderStorage);
-	joinKnowledgeHelper(m_memory, _olderMemory);
+	if (!_locations.storageSlots)
+		m_storage.clear();
+	else if (!_locations.storageSlots->empty())
+	{
+		set<YulString> keysToErase;
+		for (auto const& item: m_storage.values)
+			for (u256 const& slot: *_locations.storageSlots)
+				if (!m_knowledgeBase.knownToBeDifferent(item.first, slot))
+				{
+					keysToErase.insert(item.first);
+					break;
+				}
+		for (YulString const& key: keysToErase)
+			m_storage.eraseKey(key);
+	}
+
+	if (!_locations.memoryWords)
+		m_memory.clear();
+	else if (!_locations.memoryWords->empty())
+	{
+		set<YulString> keysToErase;
+		for (auto const& item: m_memory.values)
+			for (u256 const& offset: *_locations.memoryWords)
+				if (!m_knowledgeBase.knownToBeDifferentByAtLeast32(item.first, offset))
+				{
+					keysToErase.insert(item.first);
+					break;
+				}
+		for (YulString const& key: keysToErase)
+			m_memory.eraseKey(key);
+	}
+}
+
+void DataFlowAnalyzer::pushKnowledgeCheckpoint()
+{
+	m_storage.pushCheckpoint();
+	m_memory.pushCheckpoint();
 }
 
-void DataFlowAnalyzer::joinKnowledgeHelper(
-	InvertibleMap<YulString, YulString>& _this,
-	InvertibleMap<YulString, YulString> const& _older
-)
+void DataFlowAnalyzer::joinKnowledge()
 {
-	// We clear if the key does not exist in the older map or if the value is different.
-	// This also works for memory because _older is an "older version"
+	// We clear if the key does not exist in the older state or if the value is different.
+	// Only keys that were modified since the checkpoint can be affected.
+	// This also works for memory because the checkpoint is an "older version"
 	// of m_memory and thus any overlapping write would have cleared the keys
 	// that are not known to be different inside m_memory already.
-	set<YulString> keysToErase;
-	for (auto const& item: _this.values)
-	{
-		auto it = _older.values.find(item.first);
-		if (it == _older.values.end() || it->second != item.second)
-			keysToErase.insert(item.first);
-	}
-	for (auto const& key: keysToErase)
-		_this.eraseKey(key);
+	m_storage.joinWithCheckpoint();
+	m_memory.joinWithCheckpoint();
 }
 
 bool DataFlowAnalyzer::inScope(YulString _variableName) const
@@ -24,6 +24,7 @@
 
 #include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/KnowledgeBase.h>
+#include <libyul/optimiser/Semantics.h>
 #include <libyul/YulString.h>
 #include <libyul/AsmData.h>
 #include <libyul/SideEffects.h>
@@ -85,12 +86,17 @@ public:
 	///            Side-effects of user-defined functions. Worst-case side-effects are assumed
 	///            if this is not provided or the function is not found.
 	///            The parameter is mostly used to determine movability of expressions.
+	/// @param _functionStoreLocations
+	///            Storage slots and memory words written to by user-defined functions.
+	///            Used to keep knowledge about storage and memory across calls.
 	explicit DataFlowAnalyzer(
 		Dialect const& _dialect,
-		std::map<YulString, SideEffects> _functionSideEffects = {}
+		std::map<YulString, SideEffects> _functionSideEffects = {},
+		std::map<YulString, StoreLocations> _functionStoreLocations = {}
 	):
 		m_dialect(_dialect),
 		m_functionSideEffects(std::move(_functionSideEffects)),
+		m_functionStoreLocations(std::move(_functionStoreLocations)),
 		m_knowledgeBase(_dialect, m_value)
 	{}
 
@@ -118,7 +124,9 @@ protected:
 	/// for example at points where control flow is merged.
 	void clearValues(std::set<YulString> _names);
 
-	void assignValue(YulString _variable, Expression const* _value);
+	/// Sets the current value of @a _variable. Derived classes can override this
+	/// to maintain additional indices over the values.
+	virtual void assignValue(YulString _variable, Expression const* _value);
 
 	/// Clears knowledge about storage or memory if they may be modified inside the block.
 	void clearKnowledgeIfInvalidated(Block const& _block);
@@ -126,18 +134,18 @@ protected:
 	/// Clears knowledge about storage or memory if they may be modified inside the expression.
 	void clearKnowledgeIfInvalidated(Expression const& _expression);
 
-	/// Joins knowledge about storage and memory with an older point in the control-flow.
-	/// This only works if the current state is a direct successor of the older point,
-	/// i.e. `_otherStorage` and `_otherMemory` cannot have additional changes.
-	void joinKnowledge(
-		InvertibleMap<YulString, YulString> const& _olderStorage,
-		InvertibleMap<YulString, YulString> const& _olderMemory
-	);
+	/// Clears knowledge about storage slots and memory words that might overlap with
+	/// the given locations.
+	void clearKnowledgeAbout(StoreLocations const& _locations);
 
-	static void joinKnowledgeHelper(
-		InvertibleMap<YulString, YulString>& _thisData,
-		InvertibleMap<YulString, YulString> const& _olderData
-	);
+	/// Marks the current point in the control-flow as the one to later join with.
+	void pushKnowledgeCheckpoint();
+
+	/// Joins knowledge about storage and memory with the point in the control-flow
+	/// marked by the matching call to pushKnowledgeCheckpoint().
+	/// This only works if the current state is a direct successor of that point.
+	/// Runs in time proportional to the number of changes since that point.
+	void joinKnowledge();
 
 	/// Returns true iff the variable is in scope.
 	bool inScope(YulString _variableName) const;
@@ -151,6 +159,8 @@ protected:
 	/// Side-effects of user-defined functions. Worst-case side-effects are assumed
 	/// if this is not provided or the function is not found.
 	std::map<YulString, SideEffects> m_functionSideEffects;
+	/// Storage slots and memory words written to by user-defined functions.
+	std::map<YulString, StoreLocations> m_functionStoreLocations;
 
 	/// Current values of variables, always movable.
 	std::map<YulString, AssignedValue> m_value;
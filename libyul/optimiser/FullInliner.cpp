@@ -22,6 +22,7 @@
 
 #include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Metrics.h>
@@ -35,18 +36,33 @@
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner{_ast, _context.dispenser}.run();
+	FullInliner{_ast, _context.dispenser, _context.expectedExecutionsPerDeployment}.run();
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser):
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	optional<size_t> _expectedExecutionsPerDeployment
+):
 	m_ast(_ast), m_nameDispenser(_dispenser)
 {
+	if (_expectedExecutionsPerDeployment)
+	{
+		// The call overhead is paid on every execution, while the inlined copy is paid for
+		// once at deployment. 200 runs, the default, result in a limit of 6.
+		double runs = double(max<size_t>(*_expectedExecutionsPerDeployment, 1));
+		m_inlineSizeLimit = size_t(clamp(round(6.0 * (1.0 + log10(runs / 200.0))), 2.0, 24.0));
+	}
+
 	// Determine constants
 	SSAValueTracker tracker;
 	tracker(m_ast);
@@ -70,21 +86,58 @@ FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser):
 			m_singleUse.emplace(fun.name);
 		updateCodeSize(fun);
 	}
+	for (auto const& size: m_functionSizes)
+		m_totalSize += size.second;
+	m_totalSizeLimit = max(m_totalSize, CodeSizeLimit);
 }
 
 void FullInliner::run()
 {
+	for (FunctionDefinition* fun: functionsInCallGraphOrder())
+	{
+		handleBlock(fun->name, fun->body);
+		updateCodeSize(*fun);
+	}
+
 	for (auto& statement: m_ast.statements)
 		if (holds_alternative<Block>(statement))
 			handleBlock({}, std::get<Block>(statement));
+}
 
-	// TODO it might be good to determine a visiting order:
-	// first handle functions that are called from many places.
+vector<FunctionDefinition*> FullInliner::functionsInCallGraphOrder() const
+{
+	CallGraph callGraph = CallGraphGenerator::callGraph(m_ast);
+	map<YulString, set<YulString>> callees;
 	for (auto const& fun: m_functions)
 	{
-		handleBlock(fun.second->name, fun.second->body);
-		updateCodeSize(*fun.second);
+		callees[fun.first];
+		for (YulString callee: callGraph.functionCalls[fun.first])
+			if (m_functions.count(callee))
+				callees[fun.first].insert(callee);
 	}
+
+	// Repeatedly take out all functions that do not call any of the remaining ones.
+	vector<FunctionDefinition*> order;
+	while (true)
+	{
+		vector<YulString> leaves;
+		for (auto const& [fun, calls]: callees)
+			if (calls.empty())
+				leaves.emplace_back(fun);
+		if (leaves.empty())
+			break;
+		for (YulString leaf: leaves)
+		{
+			order.emplace_back(m_functions.at(leaf));
+			callees.erase(leaf);
+		}
+		for (auto& call: callees)
+			for (YulString leaf: leaves)
+				call.second.erase(leaf);
+	}
+	for (auto const& fun: callees)
+		order.emplace_back(m_functions.at(fun.first));
+	return order;
 }
 
 bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
@@ -112,6 +165,10 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 	if (m_singleUse.count(calledFunction->name))
 		return true;
 
+	// Everything below duplicates code, which is only done within the size budget.
+	if (m_totalSize + size > m_totalSizeLimit)
+		return false;
+
 	// Constant arguments might provide a means for further optimization, so they cause a bonus.
 	bool constantArg = false;
 	for (auto const& argument: _funCall.arguments)
@@ -124,17 +181,21 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 			break;
 		}
 
-	return (size < 6 || (constantArg && size < 12));
+	return (size < m_inlineSizeLimit || (constantArg && size < 2 * m_inlineSizeLimit));
 }
 
 void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _callSite)
 {
 	m_functionSizes.at(_callSite) += m_functionSizes.at(_function);
+	m_totalSize += m_functionSizes.at(_function);
 }
 
 void FullInliner::updateCodeSize(FunctionDefinition const& _fun)
 {
-	m_functionSizes[_fun.name] = CodeSize::codeSize(_fun.body);
+	size_t& size = m_functionSizes[_fun.name];
+	m_totalSize -= size;
+	size = CodeSize::codeSize(_fun.body);
+	m_totalSize += size;
 }
 
 void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
@@ -62,6 +62,15 @@ class NameCollector;
  * code of f, with replacements: a -> f_a, b -> f_b, c -> f_c
  * let z := f_c
  *
+ * Functions are processed bottom-up in the call graph, so that everything that can be
+ * inlined into a function has been inlined before the function itself is considered
+ * for inlining into its callers.
+ *
+ * Whether a function is inlined depends on its size, the size of the calling function,
+ * constant arguments and, if known, the expected number of executions: More executions make
+ * the saved call overhead more valuable compared to the duplicated code. Inlining that increases
+ * the code size stops once the total size reaches CodeSizeLimit.
+ *
  * Prerequisites: Disambiguator
  * More efficient if run after: Function Hoister, Expression Splitter
  */
@@ -69,6 +78,9 @@ class FullInliner: public ASTModifier
 {
 public:
 	static constexpr char const* name{"FullInliner"};
+	/// Rough approximation of the EIP-170 contract size limit of 24576 bytes in units of CodeSize.
+	static constexpr size_t CodeSizeLimit = 12288;
+
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	/// Inlining heuristic.
@@ -89,9 +101,13 @@ public:
 	void tentativelyUpdateCodeSize(YulString _function, YulString _callSite);
 
 private:
-	FullInliner(Block& _ast, NameDispenser& _dispenser);
+	FullInliner(Block& _ast, NameDispenser& _dispenser, std::optional<size_t> _expectedExecutionsPerDeployment);
 	void run();
 
+	/// @returns the functions ordered such that callees come before their callers.
+	/// Functions that are part of or depend on recursion come last.
+	std::vector<FunctionDefinition*> functionsInCallGraphOrder() const;
+
 	void updateCodeSize(FunctionDefinition const& _fun);
 	void handleBlock(YulString _currentFunctionName, Block& _block);
 	bool recursive(FunctionDefinition const& _fun) const;
@@ -107,6 +123,12 @@ private:
 	/// Variables that are constants (used for inlining heuristic)
 	std::set<YulString> m_constants;
 	std::map<YulString, size_t> m_functionSizes;
+	/// Sum of all values in m_functionSizes.
+	size_t m_totalSize = 0;
+	/// Inlining that duplicates code stops once m_totalSize would exceed this value.
+	size_t m_totalSizeLimit = 0;
+	/// Size limit for functions to be inlined, doubled in case of constant arguments.
+	size_t m_inlineSizeLimit = 6;
 	NameDispenser& m_nameDispenser;
 };
 
@@ -0,0 +1,223 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimiser component that creates copies of functions for recurring constant arguments.
+ */
+
+#include <libyul/optimiser/FunctionSpecializer.h>
+
+#include <libyul/optimiser/FullInliner.h>
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/SSAValueTracker.h>
+#include <libyul/AsmData.h>
+#include <libyul/Utilities.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+class FunctionCallCollector: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+	void operator()(FunctionCall const& _funCall) override
+	{
+		calls.emplace_back(&_funCall);
+		ASTWalker::operator()(_funCall);
+	}
+
+	vector<FunctionCall const*> calls;
+};
+
+}
+
+void FunctionSpecializer::run(OptimiserStepContext& _context, Block& _ast)
+{
+	FunctionSpecializer specializer{_context.dispenser, _ast};
+	specializer.createSpecializations(_ast);
+	specializer(_ast);
+}
+
+FunctionSpecializer::FunctionSpecializer(NameDispenser& _nameDispenser, Block const& _ast):
+	m_nameDispenser(_nameDispenser)
+{
+	SSAValueTracker tracker;
+	tracker(_ast);
+	for (auto const& [variable, value]: tracker.values())
+		if (value && holds_alternative<Literal>(*value))
+			m_constants.emplace(variable, std::get<Literal>(*value));
+}
+
+void FunctionSpecializer::operator()(FunctionCall& _funCall)
+{
+	ASTModifier::operator()(_funCall);
+
+	auto specializations = m_specializations.find(_funCall.functionName.name);
+	if (specializations == m_specializations.end())
+		return;
+	vector<optional<Literal>> arguments = constantArguments(_funCall);
+	auto it = specializations->second.find(argumentValues(arguments));
+	if (it == specializations->second.end())
+		return;
+
+	// Constant arguments are literals or identifiers, so they can be removed.
+	vector<Expression> remainingArguments;
+	for (size_t i = 0; i < arguments.size(); ++i)
+		if (!arguments[i])
+			remainingArguments.emplace_back(std::move(_funCall.arguments[i]));
+	_funCall.functionName.name = it->second;
+	_funCall.arguments = std::move(remainingArguments);
+}
+
+void FunctionSpecializer::createSpecializations(Block& _ast)
+{
+	map<YulString, FunctionDefinition const*> functions;
+	for (auto const& statement: _ast.statements)
+		if (holds_alternative<FunctionDefinition>(statement))
+		{
+			FunctionDefinition const& function = std::get<FunctionDefinition>(statement);
+			functions[function.name] = &function;
+		}
+
+	struct Candidate
+	{
+		size_t calls = 0;
+		vector<optional<Literal>> arguments;
+	};
+	map<pair<YulString, ArgumentValues>, Candidate> candidates;
+	FunctionCallCollector collector;
+	collector(_ast);
+	for (FunctionCall const* call: collector.calls)
+	{
+		if (!functions.count(call->functionName.name))
+			continue;
+		vector<optional<Literal>> arguments = constantArguments(*call);
+		if (none_of(arguments.begin(), arguments.end(), [](auto const& _argument) { return _argument.has_value(); }))
+			continue;
+		Candidate& candidate = candidates[{call->functionName.name, argumentValues(arguments)}];
+		candidate.calls++;
+		candidate.arguments = std::move(arguments);
+	}
+
+	// Most frequently used combinations first.
+	vector<decltype(candidates)::value_type const*> order;
+	for (auto const& candidate: candidates)
+		if (candidate.second.calls >= 2)
+			order.emplace_back(&candidate);
+	stable_sort(order.begin(), order.end(), [](auto const* _a, auto const* _b) {
+		return _a->second.calls > _b->second.calls;
+	});
+
+	size_t budget = max(CodeSize::codeSizeIncludingFunctions(_ast) / 2, 2 * MaxFunctionSize);
+	vector<FunctionDefinition> copies;
+	for (auto const* candidate: order)
+	{
+		auto const& [function, values] = candidate->first;
+		size_t size = CodeSize::codeSize(functions.at(function)->body);
+		if (size > MaxFunctionSize || size > budget)
+			continue;
+		budget -= size;
+		YulString newName = m_nameDispenser.newName(function);
+		m_specializations[function][values] = newName;
+		copies.emplace_back(specialize(*functions.at(function), newName, candidate->second.arguments));
+	}
+
+	for (FunctionDefinition& copy: copies)
+		_ast.statements.emplace_back(std::move(copy));
+}
+
+FunctionDefinition FunctionSpecializer::specialize(
+	FunctionDefinition const& _function,
+	YulString _newName,
+	vector<optional<Literal>> const& _arguments
+)
+{
+	yulAssert(_arguments.size() == _function.parameters.size(), "");
+
+	map<YulString, YulString> variableReplacements;
+	TypedNameList parameters;
+	vector<Statement> statements;
+	for (size_t i = 0; i < _function.parameters.size(); ++i)
+	{
+		TypedName const& parameter = _function.parameters[i];
+		TypedName newParameter{parameter.location, m_nameDispenser.newName(parameter.name), parameter.type};
+		variableReplacements[parameter.name] = newParameter.name;
+		if (_arguments[i])
+		{
+			Literal value = *_arguments[i];
+			value.type = parameter.type;
+			statements.emplace_back(VariableDeclaration{
+				parameter.location,
+				{newParameter},
+				make_unique<Expression>(std::move(value))
+			});
+		}
+		else
+			parameters.emplace_back(std::move(newParameter));
+	}
+	TypedNameList returnVariables;
+	for (TypedName const& returnVariable: _function.returnVariables)
+	{
+		TypedName newReturnVariable{returnVariable.location, m_nameDispenser.newName(returnVariable.name), returnVariable.type};
+		variableReplacements[returnVariable.name] = newReturnVariable.name;
+		returnVariables.emplace_back(std::move(newReturnVariable));
+	}
+
+	Block body = std::get<Block>(BodyCopier(m_nameDispenser, variableReplacements)(_function.body));
+	for (Statement& statement: body.statements)
+		statements.emplace_back(std::move(statement));
+
+	return FunctionDefinition{
+		_function.location,
+		_newName,
+		std::move(parameters),
+		std::move(returnVariables),
+		Block{_function.body.location, std::move(statements)}
+	};
+}
+
+vector<optional<Literal>> FunctionSpecializer::constantArguments(FunctionCall const& _funCall) const
+{
+	vector<optional<Literal>> arguments;
+	for (Expression const& argument: _funCall.arguments)
+		if (holds_alternative<Literal>(argument))
+			arguments.emplace_back(std::get<Literal>(argument));
+		else if (
+			holds_alternative<Identifier>(argument) &&
+			m_constants.count(std::get<Identifier>(argument).name)
+		)
+			arguments.emplace_back(m_constants.at(std::get<Identifier>(argument).name));
+		else
+			arguments.emplace_back(nullopt);
+	return arguments;
+}
+
+FunctionSpecializer::ArgumentValues FunctionSpecializer::argumentValues(vector<optional<Literal>> const& _arguments)
+{
+	ArgumentValues values;
+	for (auto const& argument: _arguments)
+		values.emplace_back(argument ? optional<u256>(valueOfLiteral(*argument)) : nullopt);
+	return values;
+}
@@ -0,0 +1,90 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimiser component that creates copies of functions for recurring constant arguments.
+ */
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/AsmData.h>
+
+#include <libsolutil/Common.h>
+
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace solidity::yul
+{
+
+class NameDispenser;
+
+/**
+ * Optimiser component that creates specialised copies of functions that are called
+ * with the same constant arguments from several places.
+ *
+ * The copy does not have the constant parameters. Instead, they are declared as variables
+ * initialised with the constant at the start of the body, so that subsequent steps can
+ * simplify the copy for these particular values. All calls with matching constant
+ * arguments are redirected to the copy. The copies are appended to the top-level block.
+ *
+ * An argument is constant if it is a literal or an SSA variable with a literal value.
+ * A function is only copied if the same combination of constant arguments occurs in at
+ * least two calls, if it is not larger than MaxFunctionSize and as long as the total size
+ * of the copies created in one run is at most half of the size of the code.
+ * Copies that turn out to be equivalent after simplification are merged again by the
+ * EquivalentFunctionCombiner.
+ *
+ * Prerequisites: Disambiguator, Function Hoister, Function Grouper
+ */
+class FunctionSpecializer: public ASTModifier
+{
+public:
+	static constexpr char const* name{"FunctionSpecializer"};
+	static constexpr size_t MaxFunctionSize = 30;
+	static void run(OptimiserStepContext& _context, Block& _ast);
+
+	using ASTModifier::operator();
+	void operator()(FunctionCall& _funCall) override;
+
+private:
+	/// Values of the constant arguments of a call, nullopt for the other arguments.
+	using ArgumentValues = std::vector<std::optional<u256>>;
+
+	FunctionSpecializer(NameDispenser& _nameDispenser, Block const& _ast);
+
+	/// Selects the functions and arguments to specialise for and appends the copies to @a _ast.
+	void createSpecializations(Block& _ast);
+	FunctionDefinition specialize(
+		FunctionDefinition const& _function,
+		YulString _newName,
+		std::vector<std::optional<Literal>> const& _arguments
+	);
+
+	/// @returns the literal value of each argument of the call, if it is constant.
+	std::vector<std::optional<Literal>> constantArguments(FunctionCall const& _funCall) const;
+	static ArgumentValues argumentValues(std::vector<std::optional<Literal>> const& _arguments);
+
+	NameDispenser& m_nameDispenser;
+	/// SSA variables with literal values.
+	std::map<YulString, Literal> m_constants;
+	/// Name of the specialised copy for each function and combination of constant arguments.
+	std::map<YulString, std::map<ArgumentValues, YulString>> m_specializations;
+};
+
+}
@@ -0,0 +1,371 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimiser component that removes conditions proven by the loop condition and
+ * replaces multiplications of induction variables by additions.
+ */
+
+#include <libyul/optimiser/InductionVariableSimplifier.h>
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/optimiser/SSAValueTracker.h>
+#include <libyul/optimiser/SyntacticalEquality.h>
+
+#include <libyul/Dialect.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Utilities.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+/**
+ * Collects all multiplications of an induction variable by a constant.
+ */
+class MultiplicationCollector: public ASTModifier
+{
+public:
+	MultiplicationCollector(
+		map<YulString, u256> const& _steps,
+		function<optional<u256>(Expression const&)> _constantValue
+	):
+		m_steps(_steps),
+		m_constantValue(std::move(_constantValue))
+	{}
+
+	using ASTModifier::operator();
+	using ASTModifier::visit;
+	void visit(Expression& _expression) override
+	{
+		if (FunctionCall* call = get_if<FunctionCall>(&_expression))
+			if (call->functionName.name == "mul"_yulstring && call->arguments.size() == 2)
+				for (size_t i = 0; i < 2; ++i)
+					if (Identifier const* variable = get_if<Identifier>(&call->arguments[i]))
+						if (m_steps.count(variable->name))
+							if (optional<u256> factor = m_constantValue(call->arguments[1 - i]))
+							{
+								occurrences[{variable->name, *factor}].push_back(&_expression);
+								return;
+							}
+		ASTModifier::visit(_expression);
+	}
+
+	/// Occurrences of the multiplications by induction variable and factor.
+	map<pair<YulString, u256>, vector<Expression*>> occurrences;
+
+private:
+	map<YulString, u256> const& m_steps;
+	function<optional<u256>(Expression const&)> m_constantValue;
+};
+
+}
+
+void InductionVariableSimplifier::run(OptimiserStepContext& _context, Block& _ast)
+{
+	SSAValueTracker tracker;
+	tracker(_ast);
+	map<YulString, u256> constants;
+	for (auto const& [variable, value]: tracker.values())
+		if (value && holds_alternative<Literal>(*value) && std::get<Literal>(*value).kind == LiteralKind::Number)
+			constants[variable] = valueOfLiteral(std::get<Literal>(*value));
+
+	InductionVariableSimplifier{
+		_context.dialect,
+		_context.dispenser,
+		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		std::move(constants),
+		MSizeFinder::containsMSize(_context.dialect, _ast)
+	}.simplify(_ast, {});
+}
+
+InductionVariableSimplifier::InductionVariableSimplifier(
+	Dialect const& _dialect,
+	NameDispenser& _nameDispenser,
+	map<YulString, SideEffects> _functionSideEffects,
+	map<YulString, u256> _constants,
+	bool _containsMSize
+):
+	m_dialect(_dialect),
+	m_nameDispenser(_nameDispenser),
+	m_functionSideEffects(std::move(_functionSideEffects)),
+	m_constants(std::move(_constants)),
+	m_containsMSize(_containsMSize)
+{
+}
+
+void InductionVariableSimplifier::simplify(Block& _block, vector<KnownCondition> _known)
+{
+	TerminationFinder terminationFinder{m_dialect};
+	util::iterateReplacing(
+		_block.statements,
+		[&](Statement& _statement) -> optional<vector<Statement>>
+		{
+			if (If* ifStatement = get_if<If>(&_statement))
+			{
+				if (isKnownZero(*ifStatement->condition, _known))
+					return vector<Statement>{};
+				vector<KnownCondition> knownInBody = _known;
+				invalidate(knownInBody, *ifStatement->condition);
+				simplify(ifStatement->body, std::move(knownInBody));
+				invalidate(_known, _statement);
+				// If the body cannot be left regularly, the condition is zero after the statement.
+				if (
+					terminationFinder.firstUnconditionalControlFlowChange(ifStatement->body.statements).first !=
+					TerminationFinder::ControlFlow::FlowOut
+				)
+					if (optional<KnownCondition> condition = knownCondition(*ifStatement->condition, false))
+						_known.emplace_back(std::move(*condition));
+				return {};
+			}
+			else if (Switch* switchStatement = get_if<Switch>(&_statement))
+			{
+				vector<KnownCondition> knownInCases = _known;
+				invalidate(knownInCases, *switchStatement->expression);
+				for (Case& switchCase: switchStatement->cases)
+					simplify(switchCase.body, knownInCases);
+			}
+			else if (ForLoop* loop = get_if<ForLoop>(&_statement))
+			{
+				invalidate(_known, _statement);
+				return simplifyLoop(*loop);
+			}
+			else if (Block* block = get_if<Block>(&_statement))
+				simplify(*block, _known);
+			else if (FunctionDefinition* function = get_if<FunctionDefinition>(&_statement))
+			{
+				simplify(function->body, {});
+				return {};
+			}
+			invalidate(_known, _statement);
+			return {};
+		}
+	);
+}
+
+optional<vector<Statement>> InductionVariableSimplifier::simplifyLoop(ForLoop& _loop)
+{
+	yulAssert(_loop.pre.statements.empty(), "Need to run the for loop init rewriter first.");
+
+	// The body is only entered if the condition is non-zero, but
+	// nothing is known at the start of the post block.
+	vector<KnownCondition> known;
+	if (optional<KnownCondition> condition = knownCondition(*_loop.condition, true))
+		known.emplace_back(std::move(*condition));
+	simplify(_loop.body, std::move(known));
+	simplify(_loop.post, {});
+
+	vector<Statement> declarations = reduceStrength(_loop);
+	if (declarations.empty())
+		return {};
+	declarations.emplace_back(std::move(_loop));
+	return {std::move(declarations)};
+}
+
+vector<Statement> InductionVariableSimplifier::reduceStrength(ForLoop& _loop)
+{
+	if (!m_dialect.builtin("mul"_yulstring) || !m_dialect.builtin("add"_yulstring))
+		return {};
+
+	AssignmentCounter assignmentCounter;
+	assignmentCounter(_loop.body);
+	assignmentCounter(_loop.post);
+
+	// Induction variables and the constant they are increased by in each iteration.
+	map<YulString, u256> steps;
+	for (Statement const& statement: _loop.post.statements)
+		if (Assignment const* assignment = get_if<Assignment>(&statement))
+		{
+			if (assignment->variableNames.size() != 1)
+				continue;
+			YulString variable = assignment->variableNames.front().name;
+			FunctionCall const* increment = get_if<FunctionCall>(assignment->value.get());
+			if (
+				assignmentCounter.assignmentCount(variable) != 1 ||
+				!increment ||
+				increment->functionName.name != "add"_yulstring ||
+				increment->arguments.size() != 2
+			)
+				continue;
+			for (size_t i = 0; i < 2; ++i)
+				if (Identifier const* identifier = get_if<Identifier>(&increment->arguments[i]))
+					if (identifier->name == variable)
+						if (optional<u256> step = constantValue(increment->arguments[1 - i]))
+						{
+							steps[variable] = *step;
+							break;
+						}
+		}
+	if (steps.empty())
+		return {};
+
+	MultiplicationCollector collector{steps, [&](Expression const& _expression) { return constantValue(_expression); }};
+	collector.visit(*_loop.condition);
+	collector(_loop.body);
+
+	vector<pair<pair<YulString, u256>, vector<Expression*>>> candidates;
+	for (auto& [multiplication, occurrences]: collector.occurrences)
+		if (occurrences.size() >= MinOccurrences)
+			candidates.emplace_back(multiplication, std::move(occurrences));
+	stable_sort(candidates.begin(), candidates.end(), [](auto const& _a, auto const& _b) {
+		return _a.second.size() > _b.second.size();
+	});
+	if (candidates.size() > MaxNewVariables)
+		candidates.resize(MaxNewVariables);
+
+	langutil::SourceLocation const location = _loop.location;
+	auto literal = [&](u256 const& _value) -> Expression {
+		return Literal{location, LiteralKind::Number, YulString{util::formatNumber(_value)}, m_dialect.defaultType};
+	};
+	vector<Statement> declarations;
+	for (auto& [multiplication, occurrences]: candidates)
+	{
+		auto const& [variable, factor] = multiplication;
+		YulString product = m_nameDispenser.newName(variable);
+		declarations.emplace_back(VariableDeclaration{
+			location,
+			{TypedName{location, product, m_dialect.defaultType}},
+			make_unique<Expression>(FunctionCall{
+				location,
+				Identifier{location, "mul"_yulstring},
+				util::make_vector<Expression>(Identifier{location, variable}, literal(factor))
+			})
+		});
+		for (Expression* occurrence: occurrences)
+			*occurrence = Identifier{locationOf(*occurrence), product};
+		_loop.post.statements.emplace_back(Assignment{
+			location,
+			{Identifier{location, product}},
+			make_unique<Expression>(FunctionCall{
+				location,
+				Identifier{location, "add"_yulstring},
+				util::make_vector<Expression>(Identifier{location, product}, literal(steps.at(variable) * factor))
+			})
+		});
+	}
+	return declarations;
+}
+
+optional<InductionVariableSimplifier::KnownCondition> InductionVariableSimplifier::knownCondition(
+	Expression const& _condition,
+	bool _nonZero
+) const
+{
+	SideEffectsCollector sideEffects{m_dialect, _condition, &m_functionSideEffects};
+	if (!sideEffects.sideEffectFree(!m_containsMSize))
+		return nullopt;
+
+	KnownCondition known{&_condition, _nonZero, {}, !sideEffects.movable()};
+	for (auto const& [name, count]: ReferencesCounter::countReferences(_condition))
+		if (BuiltinFunction const* builtin = m_dialect.builtin(name))
+		{
+			// Other builtins that are not movable, like ``gas``, can change
+			// their value without any visible write.
+			if (!builtin->sideEffects.movable && name != "mload"_yulstring && name != "sload"_yulstring)
+				return nullopt;
+		}
+		else if (m_functionSideEffects.count(name))
+		{
+			if (!m_functionSideEffects.at(name).movable)
+				return nullopt;
+		}
+		else
+			known.variables.insert(name);
+	return known;
+}
+
+bool InductionVariableSimplifier::isKnownZero(
+	Expression const& _condition,
+	vector<KnownCondition> const& _known
+) const
+{
+	BuiltinFunction const* negation = m_dialect.booleanNegationFunction();
+	FunctionCall const* call = get_if<FunctionCall>(&_condition);
+	for (KnownCondition const& known: _known)
+		if (!known.nonZero)
+		{
+			if (SyntacticallyEqual{}(_condition, *known.condition))
+				return true;
+		}
+		else if (
+			negation &&
+			call &&
+			call->functionName.name == negation->name &&
+			call->arguments.size() == 1 &&
+			SyntacticallyEqual{}(call->arguments.front(), *known.condition)
+		)
+			return true;
+	return false;
+}
+
+void InductionVariableSimplifier::invalidate(vector<KnownCondition>& _known, Statement const& _statement) const
+{
+	SideEffectsCollector sideEffects{m_dialect, &m_functionSideEffects};
+	sideEffects.visit(_statement);
+	Assignments assignments;
+	assignments.visit(_statement);
+	invalidate(_known, sideEffects.invalidatesStorage() || sideEffects.invalidatesMemory(), assignments.names());
+}
+
+void InductionVariableSimplifier::invalidate(vector<KnownCondition>& _known, Expression const& _expression) const
+{
+	SideEffectsCollector sideEffects{m_dialect, _expression, &m_functionSideEffects};
+	invalidate(_known, sideEffects.invalidatesStorage() || sideEffects.invalidatesMemory(), {});
+}
+
+void InductionVariableSimplifier::invalidate(
+	vector<KnownCondition>& _known,
+	bool _invalidatesState,
+	set<YulString> const& _assignedVariables
+) const
+{
+	_known.erase(
+		remove_if(_known.begin(), _known.end(), [&](KnownCondition const& _condition) {
+			if (_condition.readsState && _invalidatesState)
+				return true;
+			for (YulString variable: _condition.variables)
+				if (_assignedVariables.count(variable))
+					return true;
+			return false;
+		}),
+		_known.end()
+	);
+}
+
+optional<u256> InductionVariableSimplifier::constantValue(Expression const& _expression) const
+{
+	if (Literal const* literal = get_if<Literal>(&_expression))
+	{
+		if (literal->kind == LiteralKind::Number)
+			return valueOfLiteral(*literal);
+	}
+	else if (Identifier const* identifier = get_if<Identifier>(&_expression))
+		if (m_constants.count(identifier->name))
+			return m_constants.at(identifier->name);
+	return nullopt;
+}
@@ -0,0 +1,124 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimiser component that removes conditions proven by the loop condition and
+ * replaces multiplications of induction variables by additions.
+ */
+#pragma once
+
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/AsmData.h>
+#include <libyul/SideEffects.h>
+
+#include <libsolutil/Common.h>
+
+#include <map>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+class NameDispenser;
+
+/**
+ * Optimiser component that simplifies for loops using what is known about their
+ * condition and their induction variables.
+ *
+ * Removal of redundant checks: At the start of a loop body, the loop condition is known
+ * to be non-zero and after a statement ``if c { ... }`` whose body always breaks, continues,
+ * leaves or terminates, ``c`` is known to be zero. A later ``if c' { ... }`` where ``c'`` is
+ * syntactically equal to such a condition is removed, as long as no statement in between
+ * assigns to a variable in the condition and, for conditions that read memory or storage,
+ * no statement in between writes to memory or storage. With the loop condition
+ * ``lt(i, n)``, this removes the bounds check ``if iszero(lt(i, n)) { invalid() }`` that
+ * remains after inlining an index access into the loop body.
+ * Only conditions that are side-effect free and only call movable builtins, ``mload``
+ * or ``sload`` are considered.
+ *
+ * Strength reduction: An induction variable is a variable ``i`` that is only assigned to
+ * once in the loop, namely by a statement ``i := add(i, c)`` at the top level of the post
+ * block, where ``c`` is a constant. Multiplications ``mul(i, k)`` in the condition or the body
+ * with a constant ``k`` are replaced by a new variable that is initialised to ``mul(i, k)``
+ * in front of the loop and incremented by ``c * k`` at the end of the post block.
+ * On the EVM, a multiplication is only slightly more expensive than an addition, so this is
+ * only done for multiplications that occur at least MinOccurrences times and for at most
+ * MaxNewVariables multiplications per loop, since every new variable occupies a stack slot.
+ *
+ * Constants are number literals or SSA variables with a number literal as value.
+ *
+ * Prerequisite: Disambiguator, ForLoopInitRewriter, Function Hoister.
+ */
+class InductionVariableSimplifier
+{
+public:
+	static constexpr char const* name{"InductionVariableSimplifier"};
+	static constexpr size_t MinOccurrences = 2;
+	static constexpr size_t MaxNewVariables = 2;
+	static void run(OptimiserStepContext& _context, Block& _ast);
+
+private:
+	/// A condition that is known to evaluate to zero (or to non-zero if @a nonZero is set).
+	struct KnownCondition
+	{
+		Expression const* condition = nullptr;
+		bool nonZero = false;
+		std::set<YulString> variables;
+		bool readsState = false;
+	};
+
+	InductionVariableSimplifier(
+		Dialect const& _dialect,
+		NameDispenser& _nameDispenser,
+		std::map<YulString, SideEffects> _functionSideEffects,
+		std::map<YulString, u256> _constants,
+		bool _containsMSize
+	);
+
+	/// Removes conditional statements in @a _block whose condition is known to be zero.
+	void simplify(Block& _block, std::vector<KnownCondition> _known);
+	/// Simplifies the body of the loop and @returns the loop preceded by the declarations
+	/// of the variables that replace multiplications, if any.
+	std::optional<std::vector<Statement>> simplifyLoop(ForLoop& _loop);
+	std::vector<Statement> reduceStrength(ForLoop& _loop);
+
+	/// @returns the description of @a _condition if it can be used for later comparisons.
+	std::optional<KnownCondition> knownCondition(Expression const& _condition, bool _nonZero) const;
+	/// @returns true if @a _condition is syntactically equal to a condition known to be zero.
+	bool isKnownZero(Expression const& _condition, std::vector<KnownCondition> const& _known) const;
+	/// Removes all conditions that might change their value when executing @a _statement.
+	void invalidate(std::vector<KnownCondition>& _known, Statement const& _statement) const;
+	void invalidate(std::vector<KnownCondition>& _known, Expression const& _expression) const;
+	void invalidate(
+		std::vector<KnownCondition>& _known,
+		bool _invalidatesState,
+		std::set<YulString> const& _assignedVariables
+	) const;
+
+	std::optional<u256> constantValue(Expression const& _expression) const;
+
+	Dialect const& m_dialect;
+	NameDispenser& m_nameDispenser;
+	std::map<YulString, SideEffects> m_functionSideEffects;
+	/// SSA variables with number literals as values.
+	std::map<YulString, u256> m_constants;
+	bool m_containsMSize = true;
+};
+
+}
@@ -35,28 +35,54 @@ using namespace solidity;
 using namespace solidity::yul;
 
 bool KnowledgeBase::knownToBeDifferent(YulString _a, YulString _b)
+{
+	return knownToBeDifferent(Identifier{{}, _a}, Identifier{{}, _b});
+}
+
+bool KnowledgeBase::knownToBeDifferent(YulString _a, u256 const& _b)
+{
+	return knownToBeDifferent(
+		Identifier{{}, _a},
+		Literal{{}, LiteralKind::Number, YulString{util::toCompactHexWithPrefix(_b)}, {}}
+	);
+}
+
+bool KnowledgeBase::knownToBeDifferentByAtLeast32(YulString _a, YulString _b)
+{
+	return knownToBeDifferentByAtLeast32(Identifier{{}, _a}, Identifier{{}, _b});
+}
+
+bool KnowledgeBase::knownToBeDifferentByAtLeast32(YulString _a, u256 const& _b)
+{
+	return knownToBeDifferentByAtLeast32(
+		Identifier{{}, _a},
+		Literal{{}, LiteralKind::Number, YulString{util::toCompactHexWithPrefix(_b)}, {}}
+	);
+}
+
+bool KnowledgeBase::knownToBeDifferent(Expression _a, Expression _b)
 {
 	// Try to use the simplification rules together with the
 	// current values to turn `sub(_a, _b)` into a nonzero constant.
 	// If that fails, try `eq(_a, _b)`.
 
-	Expression expr1 = simplify(FunctionCall{{}, {{}, "sub"_yulstring}, util::make_vector<Expression>(Identifier{{}, _a}, Identifier{{}, _b})});
+	Expression expr1 = simplify(FunctionCall{{}, {{}, "sub"_yulstring}, util::make_vector<Expression>(_a, _b)});
 	if (holds_alternative<Literal>(expr1))
 		return valueOfLiteral(std::get<Literal>(expr1)) != 0;
 
-	Expression expr2 = simplify(FunctionCall{{}, {{}, "eq"_yulstring}, util::make_vector<Expression>(Identifier{{}, _a}, Identifier{{}, _b})});
+	Expression expr2 = simplify(FunctionCall{{}, {{}, "eq"_yulstring}, util::make_vector<Expression>(std::move(_a), std::move(_b))});
 	if (holds_alternative<Literal>(expr2))
 		return valueOfLiteral(std::get<Literal>(expr2)) == 0;
 
 	return false;
 }
 
-bool KnowledgeBase::knownToBeDifferentByAtLeast32(YulString _a, YulString _b)
+bool KnowledgeBase::knownToBeDifferentByAtLeast32(Expression _a, Expression _b)
 {
 	// Try to use the simplification rules together with the
 	// current values to turn `sub(_a, _b)` into a constant whose absolute value is at least 32.
 
-	Expression expr1 = simplify(FunctionCall{{}, {{}, "sub"_yulstring}, util::make_vector<Expression>(Identifier{{}, _a}, Identifier{{}, _b})});
+	Expression expr1 = simplify(FunctionCall{{}, {{}, "sub"_yulstring}, util::make_vector<Expression>(std::move(_a), std::move(_b))});
 	if (holds_alternative<Literal>(expr1))
 	{
 		u256 val = valueOfLiteral(std::get<Literal>(expr1));
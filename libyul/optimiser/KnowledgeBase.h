@@ -22,6 +22,9 @@
 
 #include <libyul/AsmDataForward.h>
 #include <libyul/YulString.h>
+
+#include <libsolutil/Common.h>
+
 #include <map>
 
 namespace solidity::yul
@@ -44,10 +47,14 @@ public:
 	{}
 
 	bool knownToBeDifferent(YulString _a, YulString _b);
+	bool knownToBeDifferent(YulString _a, u256 const& _b);
 	bool knownToBeDifferentByAtLeast32(YulString _a, YulString _b);
+	bool knownToBeDifferentByAtLeast32(YulString _a, u256 const& _b);
 	bool knownToBeEqual(YulString _a, YulString _b) const { return _a == _b; }
 
 private:
+	bool knownToBeDifferent(Expression _a, Expression _b);
+	bool knownToBeDifferentByAtLeast32(Expression _a, Expression _b);
 	Expression simplify(Expression _expression);
 
 	Dialect const& m_dialect;
@@ -37,6 +37,7 @@ void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 	LoadResolver{
 		_context.dialect,
 		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		StoreLocationsPropagator::storeLocations(_context.dialect, _ast),
 		!containsMSize
 	}(_ast);
 }
@@ -50,9 +50,10 @@ private:
 	LoadResolver(
 		Dialect const& _dialect,
 		std::map<YulString, SideEffects> _functionSideEffects,
+		std::map<YulString, StoreLocations> _functionStoreLocations,
 		bool _optimizeMLoad
 	):
-		DataFlowAnalyzer(_dialect, std::move(_functionSideEffects)),
+		DataFlowAnalyzer(_dialect, std::move(_functionSideEffects), std::move(_functionStoreLocations)),
 		m_optimizeMLoad(_optimizeMLoad)
 	{}
 
@@ -19,6 +19,7 @@
 
 #include <libyul/Exceptions.h>
 
+#include <optional>
 #include <string>
 #include <set>
 
@@ -35,6 +36,8 @@ struct OptimiserStepContext
 	Dialect const& dialect;
 	NameDispenser& dispenser;
 	std::set<YulString> const& reservedIdentifiers;
+	/// The number of times the code is expected to be executed per deployment, if known.
+	std::optional<size_t> expectedExecutionsPerDeployment = std::nullopt;
 };
 
 
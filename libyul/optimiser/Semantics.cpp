@@ -20,10 +20,12 @@
 
 #include <libyul/optimiser/Semantics.h>
 
+#include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AsmData.h>
 #include <libyul/Dialect.h>
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/Utilities.h>
 
 #include <libevmasm/SemanticInformation.h>
 
@@ -34,6 +36,94 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
+namespace
+{
+
+/**
+ * Collects the store locations of each function without the functions it calls.
+ */
+class DirectStoreLocationsCollector: public ASTWalker
+{
+public:
+	DirectStoreLocationsCollector(Dialect const& _dialect, Block const& _ast):
+		m_dialect(_dialect)
+	{
+		SSAValueTracker tracker;
+		tracker(_ast);
+		for (auto const& [variable, value]: tracker.values())
+			if (value && holds_alternative<Literal>(*value))
+				m_constants[variable] = valueOfLiteral(std::get<Literal>(*value));
+		(*this)(_ast);
+	}
+
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override
+	{
+		YulString previousFunction = m_currentFunction;
+		m_currentFunction = _function.name;
+		locations[_function.name];
+		ASTWalker::operator()(_function);
+		m_currentFunction = previousFunction;
+	}
+
+	void operator()(FunctionCall const& _functionCall) override
+	{
+		ASTWalker::operator()(_functionCall);
+		if (m_currentFunction.empty())
+			return;
+
+		BuiltinFunction const* builtin = m_dialect.builtin(_functionCall.functionName.name);
+		if (!builtin)
+			return;
+		StoreLocations& current = locations[m_currentFunction];
+		optional<evmasm::Instruction> instruction;
+		if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&m_dialect))
+			instruction = dialect->builtin(_functionCall.functionName.name)->instruction;
+		if (builtin->sideEffects.invalidatesStorage)
+		{
+			optional<u256> slot;
+			if (instruction == evmasm::Instruction::SSTORE)
+				slot = constantValue(_functionCall.arguments.at(0));
+			if (slot && current.storageSlots)
+				current.storageSlots->insert(*slot);
+			else
+				current.storageSlots.reset();
+		}
+		if (builtin->sideEffects.invalidatesMemory)
+		{
+			optional<u256> offset;
+			if (instruction == evmasm::Instruction::MSTORE)
+				offset = constantValue(_functionCall.arguments.at(0));
+			if (offset && current.memoryWords)
+				current.memoryWords->insert(*offset);
+			else
+				current.memoryWords.reset();
+		}
+	}
+
+	map<YulString, StoreLocations> locations;
+
+private:
+	optional<u256> constantValue(Expression const& _expression) const
+	{
+		if (holds_alternative<Literal>(_expression))
+			return valueOfLiteral(std::get<Literal>(_expression));
+		else if (holds_alternative<Identifier>(_expression))
+		{
+			auto it = m_constants.find(std::get<Identifier>(_expression).name);
+			if (it != m_constants.end())
+				return it->second;
+		}
+		return nullopt;
+	}
+
+	Dialect const& m_dialect;
+	map<YulString, u256> m_constants;
+	YulString m_currentFunction;
+};
+
+}
+
 
 SideEffectsCollector::SideEffectsCollector(
 		Dialect const& _dialect,
@@ -154,6 +244,47 @@ map<YulString, SideEffects> SideEffectsPropagator::sideEffects(
 	return ret;
 }
 
+StoreLocations& StoreLocations::operator+=(StoreLocations const& _other)
+{
+	if (storageSlots && _other.storageSlots)
+		storageSlots->insert(_other.storageSlots->begin(), _other.storageSlots->end());
+	else
+		storageSlots.reset();
+	if (memoryWords && _other.memoryWords)
+		memoryWords->insert(_other.memoryWords->begin(), _other.memoryWords->end());
+	else
+		memoryWords.reset();
+	return *this;
+}
+
+map<YulString, StoreLocations> StoreLocationsPropagator::storeLocations(
+	Dialect const& _dialect,
+	Block const& _ast
+)
+{
+	map<YulString, StoreLocations> directLocations = DirectStoreLocationsCollector{_dialect, _ast}.locations;
+	CallGraph callGraph = CallGraphGenerator::callGraph(_ast);
+
+	map<YulString, StoreLocations> ret;
+	for (auto const& function: directLocations)
+	{
+		StoreLocations locations;
+		util::BreadthFirstSearch<YulString>{{function.first}}.run(
+			[&](YulString _function, auto&& _addChild) {
+				if (!locations.storageSlots && !locations.memoryWords)
+					return;
+				if (directLocations.count(_function))
+					locations += directLocations.at(_function);
+				for (YulString callee: callGraph.functionCalls[_function])
+					if (!_dialect.builtin(callee))
+						_addChild(callee);
+			}
+		);
+		ret[function.first] = std::move(locations);
+	}
+	return ret;
+}
+
 MovableChecker::MovableChecker(Dialect const& _dialect, Expression const& _expression):
 	MovableChecker(_dialect)
 {
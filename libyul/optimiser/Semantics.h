@@ -25,6 +25,9 @@
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/AsmData.h>
 
+#include <libsolutil/Common.h>
+
+#include <optional>
 #include <set>
 
 namespace solidity::yul
@@ -90,6 +93,36 @@ public:
 	);
 };
 
+/**
+ * Storage slots and memory words written to by a piece of code, as far as they are known.
+ */
+struct StoreLocations
+{
+	/// Written storage slots, nullopt if unknown slots can be written to.
+	std::optional<std::set<u256>> storageSlots = std::set<u256>{};
+	/// Start offsets of written 32-byte memory words, nullopt if unknown memory can be written to.
+	std::optional<std::set<u256>> memoryWords = std::set<u256>{};
+
+	/// Adds the locations written to by another piece of code.
+	StoreLocations& operator+=(StoreLocations const& _other);
+};
+
+/**
+ * This class can be used to determine the storage slots and memory words that are
+ * written to by user-defined functions, including all functions they call.
+ *
+ * Only ``sstore`` and ``mstore`` with a constant first argument (a literal or an SSA variable
+ * with a literal value) result in known locations. Any other builtin that modifies storage
+ * or memory results in unknown locations.
+ *
+ * Prerequisite: Disambiguator
+ */
+class StoreLocationsPropagator
+{
+public:
+	static std::map<YulString, StoreLocations> storeLocations(Dialect const& _dialect, Block const& _ast);
+};
+
 /**
  * Class that can be used to find out if certain code contains the MSize instruction.
  *
@@ -27,11 +27,14 @@
 #include <libyul/optimiser/UnusedPruner.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/Semantics.h>
+#include <libyul/optimiser/StackToMemoryMover.h>
 
 #include <libyul/CompilabilityChecker.h>
 
 #include <libyul/AsmData.h>
 
+#include <libsolutil/Common.h>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -112,8 +115,9 @@ public:
 	map<YulString, size_t> m_numReferences;
 };
 
+/// @returns false if there was no variable that could be rematerialised.
 template <typename ASTNode>
-void eliminateVariables(
+bool eliminateVariables(
 	Dialect const& _dialect,
 	ASTNode& _node,
 	size_t _numVariables,
@@ -147,8 +151,46 @@ void eliminateVariables(
 		varsToEliminate.insert(get<1>(costs));
 	}
 
+	bool const rematerialising = !varsToEliminate.empty();
 	Rematerialiser::run(_dialect, _node, std::move(varsToEliminate));
 	UnusedPruner::runUntilStabilised(_dialect, _node, _allowMSizeOptimization);
+	return rematerialising;
+}
+
+/// Runs the compilability checker only on the functions in @a _toCheck, where the empty name
+/// denotes the main block. All other bodies are temporarily replaced by empty blocks, which keeps
+/// the function signatures visible to callers while making analysis and code transform trivial.
+/// This is valid because the stack layout of a function only depends on its own body and the
+/// signatures of the functions it calls, none of which is changed by the stack compressor.
+map<YulString, int> checkFunctions(
+	Dialect const& _dialect,
+	Object& _object,
+	bool _optimizeStackAllocation,
+	set<YulString> const& _toCheck
+)
+{
+	vector<pair<Block*, Block>> stashedBodies;
+	ScopeGuard restoreBodies([&]()
+	{
+		for (auto& [body, original]: stashedBodies)
+			*body = std::move(original);
+	});
+
+	auto stash = [&](Block& _body)
+	{
+		stashedBodies.emplace_back(&_body, Block{_body.location, {}});
+		swap(_body, stashedBodies.back().second);
+	};
+	if (!_toCheck.count(YulString{}))
+		stash(std::get<Block>(_object.code->statements.at(0)));
+	for (size_t i = 1; i < _object.code->statements.size(); ++i)
+	{
+		FunctionDefinition& fun = std::get<FunctionDefinition>(_object.code->statements[i]);
+		if (!_toCheck.count(fun.name))
+			stash(fun.body);
+	}
+
+	return CompilabilityChecker::run(_dialect, _object, _optimizeStackAllocation);
 }
 
 }
@@ -157,7 +199,8 @@ bool StackCompressor::run(
 	Dialect const& _dialect,
 	Object& _object,
 	bool _optimizeStackAllocation,
-	size_t _maxIterations
+	size_t _maxIterations,
+	GasMeter const* _meter
 )
 {
 	yulAssert(
@@ -166,21 +209,32 @@ bool StackCompressor::run(
 		"Need to run the function grouper before the stack compressor."
 	);
 	bool allowMSizeOptimzation = !MSizeFinder::containsMSize(_dialect, *_object.code);
+	// Only code modified in the previous iteration can change its compilability,
+	// so everything else is skipped after the first full check.
+	set<YulString> modified;
 	for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 	{
-		map<YulString, int> stackSurplus = CompilabilityChecker::run(_dialect, _object, _optimizeStackAllocation);
+		map<YulString, int> stackSurplus =
+			iterations == 0 ?
+			CompilabilityChecker::run(_dialect, _object, _optimizeStackAllocation) :
+			checkFunctions(_dialect, _object, _optimizeStackAllocation, modified);
 		if (stackSurplus.empty())
 			return true;
+		modified.clear();
+		// Surplus of the functions where nothing could be rematerialised anymore.
+		map<YulString, int> remainingSurplus;
 
 		if (stackSurplus.count(YulString{}))
 		{
 			yulAssert(stackSurplus.at({}) > 0, "Invalid surplus value.");
-			eliminateVariables(
+			modified.insert(YulString{});
+			if (!eliminateVariables(
 				_dialect,
 				std::get<Block>(_object.code->statements.at(0)),
 				stackSurplus.at({}),
 				allowMSizeOptimzation
-			);
+			))
+				remainingSurplus[{}] = stackSurplus.at({});
 		}
 
 		for (size_t i = 1; i < _object.code->statements.size(); ++i)
@@ -190,13 +244,18 @@ bool StackCompressor::run(
 				continue;
 
 			yulAssert(stackSurplus.at(fun.name) > 0, "Invalid surplus value.");
-			eliminateVariables(
+			modified.insert(fun.name);
+			if (!eliminateVariables(
 				_dialect,
 				fun,
 				stackSurplus.at(fun.name),
 				allowMSizeOptimzation
-			);
+			))
+				remainingSurplus[fun.name] = stackSurplus.at(fun.name);
 		}
+
+		if (!remainingSurplus.empty())
+			StackToMemoryMover::run(_dialect, _meter, _object, remainingSurplus);
 	}
 	return false;
 }
@@ -29,11 +29,15 @@ namespace solidity::yul
 struct Dialect;
 struct Object;
 struct FunctionDefinition;
+class GasMeter;
 
 /**
  * Optimisation stage that aggressively rematerializes certain variables in a function to free
  * space on the stack until it is compilable.
  *
+ * If a function cannot be compressed further, its variables are moved to memory
+ * using the StackToMemoryMover as far as that is possible.
+ *
  * Only runs on the code of the object itself, does not descend into sub-objects.
  *
  * Prerequisite: Disambiguator, Function Grouper
@@ -47,7 +51,8 @@ public:
 		Dialect const& _dialect,
 		Object& _object,
 		bool _optimizeStackAllocation,
-		size_t _maxIterations
+		size_t _maxIterations,
+		GasMeter const* _meter = nullptr
 	);
 };
 
@@ -0,0 +1,301 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that moves variables from the stack into a reserved memory area.
+ */
+
+#include <libyul/optimiser/StackToMemoryMover.h>
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+
+#include <libyul/AsmData.h>
+#include <libyul/Dialect.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+#include <libyul/Utilities.h>
+
+#include <libsolutil/Algorithms.h>
+#include <libsolutil/CommonData.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+Literal numberLiteral(langutil::SourceLocation const& _location, u256 const& _value)
+{
+	return Literal{_location, LiteralKind::Number, YulString{util::formatNumber(_value)}, {}};
+}
+
+/**
+ * Collects all calls to ``memoryguard``.
+ */
+class MemoryGuardCollector: public ASTModifier
+{
+public:
+	using ASTModifier::operator();
+	void operator()(FunctionCall& _funCall) override
+	{
+		if (_funCall.functionName.name == "memoryguard"_yulstring)
+			calls.push_back(&_funCall);
+		ASTModifier::operator()(_funCall);
+	}
+
+	vector<FunctionCall*> calls;
+};
+
+/**
+ * Determines the variables of a function body that can be moved to memory together with
+ * the costs of all accesses to them.
+ */
+class MoveCandidateSelector: public ASTWalker
+{
+public:
+	MoveCandidateSelector(size_t _readCost, size_t _writeCost):
+		m_readCost(_readCost),
+		m_writeCost(_writeCost)
+	{}
+
+	using ASTWalker::operator();
+	void operator()(VariableDeclaration const& _varDecl) override
+	{
+		if (_varDecl.variables.size() == 1)
+		{
+			m_declared.insert(_varDecl.variables.front().name);
+			addCost(_varDecl.variables.front().name, m_writeCost);
+		}
+		else
+			for (auto const& var: _varDecl.variables)
+				m_excluded.insert(var.name);
+		ASTWalker::operator()(_varDecl);
+	}
+
+	void operator()(Assignment const& _assignment) override
+	{
+		if (_assignment.variableNames.size() == 1)
+			addCost(_assignment.variableNames.front().name, m_writeCost);
+		else
+			for (auto const& var: _assignment.variableNames)
+				m_excluded.insert(var.name);
+		ASTWalker::operator()(_assignment);
+	}
+
+	void operator()(ForLoop const& _forLoop) override
+	{
+		// The pre block is executed only once.
+		(*this)(_forLoop.pre);
+		++m_loopDepth;
+		visit(*_forLoop.condition);
+		(*this)(_forLoop.body);
+		(*this)(_forLoop.post);
+		--m_loopDepth;
+	}
+
+	// We use visit(Expression) because operator()(Identifier) would also
+	// get called on left-hand-sides of assignments.
+	void visit(Expression const& _expression) override
+	{
+		if (Identifier const* identifier = get_if<Identifier>(&_expression))
+			addCost(identifier->name, m_readCost);
+		ASTWalker::visit(_expression);
+	}
+
+	/// @returns the variables that can be moved, cheapest first.
+	vector<YulString> candidates() const
+	{
+		set<pair<size_t, YulString>> sorted;
+		for (YulString name: m_declared)
+			if (!m_excluded.count(name))
+				sorted.emplace(m_costs.at(name), name);
+		vector<YulString> result;
+		for (auto const& candidate: sorted)
+			result.push_back(candidate.second);
+		return result;
+	}
+
+private:
+	void addCost(YulString _variable, size_t _cost)
+	{
+		for (size_t depth = 0; depth < min(m_loopDepth, StackToMemoryMover::MaxLoopDepth); ++depth)
+			_cost *= StackToMemoryMover::LoopCostFactor;
+		m_costs[_variable] += _cost;
+	}
+
+	size_t const m_readCost;
+	size_t const m_writeCost;
+	size_t m_loopDepth = 0;
+	/// Variables declared on their own.
+	set<YulString> m_declared;
+	/// Variables that are part of a multi-variable declaration or assignment.
+	set<YulString> m_excluded;
+	map<YulString, size_t> m_costs;
+};
+
+/**
+ * Replaces declarations, assignments and references of the given variables
+ * by accesses to their memory slots.
+ */
+class VariableMover: public ASTModifier
+{
+public:
+	explicit VariableMover(map<YulString, u256> const& _slots): m_slots(_slots) {}
+
+	using ASTModifier::operator();
+	using ASTModifier::visit;
+	void operator()(Block& _block) override
+	{
+		util::iterateReplacing(_block.statements, [&](Statement& _statement) -> optional<vector<Statement>>
+		{
+			visit(_statement);
+			if (VariableDeclaration* varDecl = get_if<VariableDeclaration>(&_statement))
+			{
+				if (varDecl->variables.size() != 1 || !m_slots.count(varDecl->variables.front().name))
+					return {};
+				Expression value =
+					varDecl->value ?
+					std::move(*varDecl->value) :
+					Expression{numberLiteral(varDecl->location, 0)};
+				return util::make_vector<Statement>(
+					store(varDecl->location, m_slots.at(varDecl->variables.front().name), std::move(value))
+				);
+			}
+			else if (Assignment* assignment = get_if<Assignment>(&_statement))
+			{
+				if (assignment->variableNames.size() != 1 || !m_slots.count(assignment->variableNames.front().name))
+					return {};
+				return util::make_vector<Statement>(
+					store(assignment->location, m_slots.at(assignment->variableNames.front().name), std::move(*assignment->value))
+				);
+			}
+			return {};
+		});
+	}
+
+	void visit(Expression& _expression) override
+	{
+		if (Identifier const* identifier = get_if<Identifier>(&_expression))
+			if (m_slots.count(identifier->name))
+			{
+				langutil::SourceLocation location = identifier->location;
+				u256 slot = m_slots.at(identifier->name);
+				_expression = FunctionCall{location, Identifier{location, "mload"_yulstring}, {numberLiteral(location, slot)}};
+				return;
+			}
+		ASTModifier::visit(_expression);
+	}
+
+private:
+	static ExpressionStatement store(langutil::SourceLocation const& _location, u256 const& _slot, Expression _value)
+	{
+		return ExpressionStatement{_location, FunctionCall{
+			_location,
+			Identifier{_location, "mstore"_yulstring},
+			util::make_vector<Expression>(numberLiteral(_location, _slot), std::move(_value))
+		}};
+	}
+
+	map<YulString, u256> const& m_slots;
+};
+
+}
+
+set<YulString> StackToMemoryMover::run(
+	Dialect const& _dialect,
+	GasMeter const* _meter,
+	Object& _object,
+	map<YulString, int> const& _stackSurplus
+)
+{
+	yulAssert(
+		_object.code &&
+		_object.code->statements.size() > 0 && holds_alternative<Block>(_object.code->statements.at(0)),
+		"Need to run the function grouper before the stack to memory mover."
+	);
+	if (!_dialect.builtin("memoryguard"_yulstring) || MSizeFinder::containsMSize(_dialect, *_object.code))
+		return {};
+
+	MemoryGuardCollector memoryGuards;
+	memoryGuards(*_object.code);
+	if (memoryGuards.calls.empty())
+		return {};
+	u256 const reservedStart = valueOfLiteral(std::get<Literal>(memoryGuards.calls.front()->arguments.front()));
+	for (FunctionCall const* call: memoryGuards.calls)
+		if (valueOfLiteral(std::get<Literal>(call->arguments.front())) != reservedStart)
+			return {};
+
+	auto costs = [&](Expression const& _expression)
+	{
+		return _meter ? _meter->costs(_expression) : CodeCost::codeCost(_dialect, _expression);
+	};
+	Literal const slot = numberLiteral({}, reservedStart);
+	size_t const readCost = costs(FunctionCall{{}, Identifier{{}, "mload"_yulstring}, {slot}});
+	size_t const writeCost = costs(FunctionCall{{}, Identifier{{}, "mstore"_yulstring}, {slot, slot}});
+
+	CallGraph const callGraph = CallGraphGenerator::callGraph(*_object.code);
+	auto recursive = [&](YulString _function) -> bool
+	{
+		if (!callGraph.functionCalls.count(_function))
+			return false;
+		return util::BreadthFirstSearch<YulString>{callGraph.functionCalls.at(_function)}.run(
+			[&](YulString _called, auto&& _addChild) {
+				if (callGraph.functionCalls.count(_called))
+					for (YulString callee: callGraph.functionCalls.at(_called))
+						_addChild(callee);
+			}
+		).visited.count(_function) > 0;
+	};
+
+	set<YulString> modified;
+	u256 reservedEnd = reservedStart;
+	auto moveVariables = [&](YulString _function, Block& _body)
+	{
+		if (!_stackSurplus.count(_function) || (!_function.empty() && recursive(_function)))
+			return;
+		MoveCandidateSelector selector{readCost, writeCost};
+		selector(_body);
+		map<YulString, u256> slots;
+		for (YulString variable: selector.candidates())
+		{
+			if (slots.size() >= size_t(_stackSurplus.at(_function)))
+				break;
+			slots[variable] = reservedEnd;
+			reservedEnd += 32;
+		}
+		if (slots.empty())
+			return;
+		VariableMover{slots}(_body);
+		modified.insert(_function);
+	};
+
+	moveVariables({}, std::get<Block>(_object.code->statements.at(0)));
+	for (size_t i = 1; i < _object.code->statements.size(); ++i)
+	{
+		FunctionDefinition& function = std::get<FunctionDefinition>(_object.code->statements[i]);
+		moveVariables(function.name, function.body);
+	}
+
+	if (reservedEnd != reservedStart)
+		for (FunctionCall* call: memoryGuards.calls)
+			std::get<Literal>(call->arguments.front()).value = YulString{util::formatNumber(reservedEnd)};
+	return modified;
+}
@@ -0,0 +1,72 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that moves variables from the stack into a reserved memory area.
+ */
+
+#pragma once
+
+#include <libyul/YulString.h>
+
+#include <map>
+#include <set>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct Object;
+class GasMeter;
+
+/**
+ * Optimisation stage that moves local variables of functions that are not compilable
+ * because of the stack limit into memory. Every moved variable gets its own 32 byte slot
+ * in an area that is reserved by increasing the argument of all calls to ``memoryguard``.
+ * Declarations of and assignments to a moved variable are replaced by ``mstore``,
+ * references by ``mload``.
+ *
+ * Only variables declared on their own are moved, never function parameters or return
+ * variables. The variables with the lowest access costs are selected first, where the
+ * costs are determined by the gas meter (or by the code cost if there is none) and an
+ * access inside a for loop counts LoopCostFactor times as much as one outside of it.
+ *
+ * Nothing is done unless all calls to ``memoryguard`` use the same value and the code
+ * does not use ``msize``. Recursive functions are skipped, since their memory slots
+ * would be shared between nested calls.
+ *
+ * Only runs on the code of the object itself, does not descend into sub-objects.
+ *
+ * Prerequisite: Disambiguator, Function Grouper
+ */
+class StackToMemoryMover
+{
+public:
+	static constexpr size_t LoopCostFactor = 8;
+	static constexpr size_t MaxLoopDepth = 4;
+
+	/// Moves up to the given number of variables of each function in @a _stackSurplus
+	/// into memory, where the empty name denotes the main block.
+	/// @returns the names of the functions that were modified.
+	static std::set<YulString> run(
+		Dialect const& _dialect,
+		GasMeter const* _meter,
+		Object& _object,
+		std::map<YulString, int> const& _stackSurplus
+	);
+};
+
+}
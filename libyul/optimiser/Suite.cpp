@@ -30,6 +30,7 @@
 #include <libyul/optimiser/DeadCodeEliminator.h>
 #include <libyul/optimiser/FunctionGrouper.h>
 #include <libyul/optimiser/FunctionHoister.h>
+#include <libyul/optimiser/FunctionSpecializer.h>
 #include <libyul/optimiser/EquivalentFunctionCombiner.h>
 #include <libyul/optimiser/ExpressionSplitter.h>
 #include <libyul/optimiser/ExpressionJoiner.h>
@@ -52,13 +53,16 @@
 #include <libyul/optimiser/RedundantAssignEliminator.h>
 #include <libyul/optimiser/VarNameCleaner.h>
 #include <libyul/optimiser/LoadResolver.h>
+#include <libyul/optimiser/InductionVariableSimplifier.h>
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/backends/evm/ConstantOptimiser.h>
+#include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmData.h>
 #include <libyul/AsmPrinter.h>
+#include <libyul/Exceptions.h>
 #include <libyul/Object.h>
 
 #include <libyul/backends/wasm/WasmDialect.h>
@@ -66,6 +70,10 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <boost/range/algorithm_ext/erase.hpp>
+
+#include <cctype>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -75,6 +83,8 @@ void OptimiserSuite::run(
 	GasMeter const* _meter,
 	Object& _object,
 	bool _optimizeStackAllocation,
+	string const& _optimisationSequence,
+	OptimiserBudget const& _budget,
 	set<YulString> const& _externallyUsedIdentifiers
 )
 {
@@ -88,193 +98,20 @@ void OptimiserSuite::run(
 	)(*_object.code));
 	Block& ast = *_object.code;
 
-	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
-
-	suite.runSequence({
-		VarDeclInitializer::name,
-		FunctionHoister::name,
-		BlockFlattener::name,
-		ForLoopInitRewriter::name,
-		DeadCodeEliminator::name,
-		FunctionGrouper::name,
-		EquivalentFunctionCombiner::name,
-		UnusedPruner::name,
-		BlockFlattener::name,
-		ControlFlowSimplifier::name,
-		LiteralRematerialiser::name,
-		ConditionalUnsimplifier::name,
-		StructuralSimplifier::name,
-		ControlFlowSimplifier::name,
-		ForLoopConditionIntoBody::name,
-		BlockFlattener::name
-	}, ast);
-
-	// None of the above can make stack problems worse.
-
-	size_t codeSize = 0;
-	for (size_t rounds = 0; rounds < 12; ++rounds)
-	{
-		{
-			size_t newSize = CodeSize::codeSizeIncludingFunctions(ast);
-			if (newSize == codeSize)
-				break;
-			codeSize = newSize;
-		}
-
-		{
-			// Turn into SSA and simplify
-			suite.runSequence({
-				ExpressionSplitter::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				ExpressionSimplifier::name,
-				CommonSubexpressionEliminator::name,
-				LoadResolver::name,
-				LoopInvariantCodeMotion::name
-			}, ast);
-		}
-
-		{
-			// perform structural simplification
-			suite.runSequence({
-				CommonSubexpressionEliminator::name,
-				ConditionalSimplifier::name,
-				LiteralRematerialiser::name,
-				ConditionalUnsimplifier::name,
-				StructuralSimplifier::name,
-				LiteralRematerialiser::name,
-				ForLoopConditionOutOfBody::name,
-				ControlFlowSimplifier::name,
-				StructuralSimplifier::name,
-				ControlFlowSimplifier::name,
-				BlockFlattener::name,
-				DeadCodeEliminator::name,
-				ForLoopConditionIntoBody::name,
-				UnusedPruner::name
-			}, ast);
-		}
-
-		{
-			// simplify again
-			suite.runSequence({
-				LoadResolver::name,
-				CommonSubexpressionEliminator::name,
-				UnusedPruner::name,
-			}, ast);
-		}
-
-		{
-			// reverse SSA
-			suite.runSequence({
-				SSAReverser::name,
-				CommonSubexpressionEliminator::name,
-				UnusedPruner::name,
-
-				ExpressionJoiner::name,
-				ExpressionJoiner::name,
-			}, ast);
-		}
-
-		// should have good "compilability" property here.
-
-		{
-			// run functional expression inliner
-			suite.runSequence({
-				ExpressionInliner::name,
-				UnusedPruner::name,
-			}, ast);
-		}
-
-		{
-			// Prune a bit more in SSA
-			suite.runSequence({
-				ExpressionSplitter::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				UnusedPruner::name,
-				RedundantAssignEliminator::name,
-				UnusedPruner::name,
-			}, ast);
-		}
-
-		{
-			// Turn into SSA again and simplify
-			suite.runSequence({
-				ExpressionSplitter::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				CommonSubexpressionEliminator::name,
-				LoadResolver::name,
-			}, ast);
-		}
-
-		{
-			// run full inliner
-			suite.runSequence({
-				FunctionGrouper::name,
-				EquivalentFunctionCombiner::name,
-				FullInliner::name,
-				BlockFlattener::name
-			}, ast);
-		}
-
-		{
-			// SSA plus simplify
-			suite.runSequence({
-				ConditionalSimplifier::name,
-				LiteralRematerialiser::name,
-				ConditionalUnsimplifier::name,
-				CommonSubexpressionEliminator::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				LoadResolver::name,
-				ExpressionSimplifier::name,
-				LiteralRematerialiser::name,
-				ForLoopConditionOutOfBody::name,
-				StructuralSimplifier::name,
-				BlockFlattener::name,
-				DeadCodeEliminator::name,
-				ControlFlowSimplifier::name,
-				CommonSubexpressionEliminator::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				ForLoopConditionIntoBody::name,
-				UnusedPruner::name,
-				CommonSubexpressionEliminator::name,
-			}, ast);
-		}
-	}
-
-	// Make source short and pretty.
-
-	suite.runSequence({
-		ExpressionJoiner::name,
-		Rematerialiser::name,
-		UnusedPruner::name,
-		ExpressionJoiner::name,
-		UnusedPruner::name,
-		ExpressionJoiner::name,
-		UnusedPruner::name,
-
-		SSAReverser::name,
-		CommonSubexpressionEliminator::name,
-		LiteralRematerialiser::name,
-		ForLoopConditionOutOfBody::name,
-		CommonSubexpressionEliminator::name,
-		UnusedPruner::name,
+	OptimiserSuite suite(
+		_dialect,
+		reservedIdentifiers,
+		Debug::None,
+		ast,
+		_budget,
+		_meter ? optional<size_t>(_meter->runs()) : nullopt
+	);
 
-		ExpressionJoiner::name,
-		Rematerialiser::name,
-		UnusedPruner::name,
-	}, ast);
+	suite.runSequence(_optimisationSequence, ast);
 
 	// This is a tuning parameter, but actually just prevents infinite loops.
 	size_t stackCompressorMaxIterations = 16;
-	suite.runSequence({
+	suite.runSequence(vector<string>{
 		FunctionGrouper::name
 	}, ast);
 	// We ignore the return value because we will get a much better error
@@ -283,9 +120,10 @@ void OptimiserSuite::run(
 		_dialect,
 		_object,
 		_optimizeStackAllocation,
-		stackCompressorMaxIterations
+		stackCompressorMaxIterations,
+		_meter
 	);
-	suite.runSequence({
+	suite.runSequence(vector<string>{
 		BlockFlattener::name,
 		DeadCodeEliminator::name,
 		ControlFlowSimplifier::name,
@@ -308,7 +146,7 @@ void OptimiserSuite::run(
 		if (ast.statements.size() > 1 && std::get<Block>(ast.statements.front()).statements.empty())
 			ast.statements.erase(ast.statements.begin());
 	}
-	suite.runSequence({
+	suite.runSequence(vector<string>{
 		VarNameCleaner::name
 	}, ast);
 
@@ -357,6 +195,8 @@ map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 			FullInliner,
 			FunctionGrouper,
 			FunctionHoister,
+			FunctionSpecializer,
+			InductionVariableSimplifier,
 			LiteralRematerialiser,
 			LoadResolver,
 			LoopInvariantCodeMotion,
@@ -372,6 +212,145 @@ map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 	return instance;
 }
 
+map<string, char> const& OptimiserSuite::stepNameToAbbreviationMap()
+{
+	static map<string, char> lookupTable{
+		{BlockFlattener::name,                'f'},
+		{CommonSubexpressionEliminator::name, 'c'},
+		{ConditionalSimplifier::name,         'C'},
+		{ConditionalUnsimplifier::name,       'U'},
+		{ControlFlowSimplifier::name,         'n'},
+		{DeadCodeEliminator::name,            'D'},
+		{EquivalentFunctionCombiner::name,    'v'},
+		{ExpressionInliner::name,             'e'},
+		{ExpressionJoiner::name,              'j'},
+		{ExpressionSimplifier::name,          's'},
+		{ExpressionSplitter::name,            'x'},
+		{ForLoopConditionIntoBody::name,      'I'},
+		{ForLoopConditionOutOfBody::name,     'O'},
+		{ForLoopInitRewriter::name,           'o'},
+		{FullInliner::name,                   'i'},
+		{FunctionGrouper::name,               'g'},
+		{FunctionHoister::name,               'h'},
+		{FunctionSpecializer::name,           'F'},
+		{InductionVariableSimplifier::name,   'Q'},
+		{LiteralRematerialiser::name,         'T'},
+		{LoadResolver::name,                  'L'},
+		{LoopInvariantCodeMotion::name,       'M'},
+		{RedundantAssignEliminator::name,     'r'},
+		{Rematerialiser::name,                'm'},
+		{SSAReverser::name,                   'V'},
+		{SSATransform::name,                  'a'},
+		{StructuralSimplifier::name,          't'},
+		{UnusedPruner::name,                  'u'},
+		{VarDeclInitializer::name,            'd'},
+	};
+	// VarNameCleaner is always run at the very end and thus has no abbreviation.
+	yulAssert(lookupTable.size() + 1 == allSteps().size(), "");
+	return lookupTable;
+}
+
+map<char, string> const& OptimiserSuite::stepAbbreviationToNameMap()
+{
+	static map<char, string> lookupTable = []()
+	{
+		map<char, string> inverse;
+		for (auto const& [name, abbreviation]: stepNameToAbbreviationMap())
+		{
+			yulAssert(!inverse.count(abbreviation), "Duplicate step abbreviation.");
+			inverse[abbreviation] = name;
+		}
+		return inverse;
+	}();
+	return lookupTable;
+}
+
+void OptimiserSuite::validateSequence(string const& _stepAbbreviations)
+{
+	bool insideLoop = false;
+	for (char abbreviation: _stepAbbreviations)
+		switch (abbreviation)
+		{
+		case ' ':
+		case '\n':
+			break;
+		case '[':
+			assertThrow(!insideLoop, OptimizerException, "Nested brackets are not supported");
+			insideLoop = true;
+			break;
+		case ']':
+			assertThrow(insideLoop, OptimizerException, "Unbalanced brackets");
+			insideLoop = false;
+			break;
+		default:
+			assertThrow(
+				stepAbbreviationToNameMap().count(abbreviation) == 1,
+				OptimizerException,
+				"'" + string(1, abbreviation) + "' is not a valid step abbreviation"
+			);
+		}
+	assertThrow(!insideLoop, OptimizerException, "Unbalanced brackets");
+}
+
+void OptimiserSuite::runSequence(string const& _stepAbbreviations, Block& _ast)
+{
+	validateSequence(_stepAbbreviations);
+
+	string input = _stepAbbreviations;
+	boost::remove_erase_if(input, [](char _c) { return isspace(_c); });
+
+	auto abbreviationsToSteps = [](string const& _sequence) -> vector<string>
+	{
+		vector<string> steps;
+		for (char abbreviation: _sequence)
+			steps.emplace_back(stepAbbreviationToNameMap().at(abbreviation));
+		return steps;
+	};
+
+	// The sequence has now been validated and must consist of pairs of segments that look like this: `aaa[bbb]`
+	// `aaa` or `[bbb]` can be empty. For example we consider a sequence like `fgo[aaf]Oo` to have
+	// four segments, the last of which is an empty bracket.
+	size_t currentPairStart = 0;
+	while (currentPairStart < input.size())
+	{
+		size_t openingBracket = input.find('[', currentPairStart);
+		size_t closingBracket = input.find(']', openingBracket);
+		size_t firstCharInside = (openingBracket == string::npos ? input.size() : openingBracket + 1);
+		yulAssert((openingBracket == string::npos) == (closingBracket == string::npos), "");
+
+		runSequence(abbreviationsToSteps(input.substr(currentPairStart, openingBracket - currentPairStart)), _ast);
+
+		if (openingBracket != string::npos)
+		{
+			vector<string> loopBody = abbreviationsToSteps(input.substr(firstCharInside, closingBracket - firstCharInside));
+			size_t codeSize = 0;
+			for (size_t round = 0; round < MaxRounds && !budgetExhausted(); ++round)
+			{
+				size_t newSize = CodeSize::codeSizeIncludingFunctions(_ast);
+				if (newSize == codeSize)
+					break;
+				codeSize = newSize;
+
+				runSequence(loopBody, _ast);
+			}
+		}
+
+		currentPairStart = (closingBracket == string::npos ? input.size() : closingBracket + 1);
+	}
+}
+
+bool OptimiserSuite::budgetExhausted() const
+{
+	if (m_budget.maxSteps > 0 && m_stepsRun >= m_budget.maxSteps)
+		return true;
+	if (
+		m_budget.maxTime.count() > 0 &&
+		chrono::steady_clock::now() - m_startTime >= m_budget.maxTime
+	)
+		return true;
+	return false;
+}
+
 void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 {
 	unique_ptr<Block> copy;
@@ -382,6 +361,7 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 		if (m_debug == Debug::PrintStep)
 			cout << "Running " << step << endl;
 		allSteps().at(step)->run(m_context, _ast);
+		m_stepsRun++;
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -26,6 +26,9 @@
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <chrono>
+#include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <memory>
@@ -38,6 +41,16 @@ struct Dialect;
 class GasMeter;
 struct Object;
 
+/**
+ * Limits on the work spent in the repeated parts of an optimisation sequence.
+ * Once a limit is reached, no further round is started. Zero means no limit.
+ */
+struct OptimiserBudget
+{
+	size_t maxSteps = 0;
+	std::chrono::milliseconds maxTime{0};
+};
+
 /**
  * Optimiser suite that combines all steps and also provides the settings for the heuristics.
  * Only optimizes the code of the provided object, does not descend into the sub-objects.
@@ -45,6 +58,8 @@ struct Object;
 class OptimiserSuite
 {
 public:
+	static constexpr size_t MaxRounds = 12;
+
 	enum class Debug
 	{
 		None,
@@ -56,28 +71,50 @@ public:
 		GasMeter const* _meter,
 		Object& _object,
 		bool _optimizeStackAllocation,
+		std::string const& _optimisationSequence,
+		OptimiserBudget const& _budget = {},
 		std::set<YulString> const& _externallyUsedIdentifiers = {}
 	);
 
+	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
+	/// @throw OptimizerException if the sequence is invalid
+	static void validateSequence(std::string const& _stepAbbreviations);
+
 	void runSequence(std::vector<std::string> const& _steps, Block& _ast);
+	/// Runs the steps given by their abbreviations. Parts in square brackets are repeated
+	/// until the code size does not change anymore, at most MaxRounds times or until the budget
+	/// is exhausted.
+	void runSequence(std::string const& _stepAbbreviations, Block& _ast);
 
 	static std::map<std::string, std::unique_ptr<OptimiserStep>> const& allSteps();
+	static std::map<std::string, char> const& stepNameToAbbreviationMap();
+	static std::map<char, std::string> const& stepAbbreviationToNameMap();
 
 private:
 	OptimiserSuite(
 		Dialect const& _dialect,
 		std::set<YulString> const& _externallyUsedIdentifiers,
 		Debug _debug,
-		Block& _ast
+		Block& _ast,
+		OptimiserBudget const& _budget = {},
+		std::optional<size_t> _expectedExecutionsPerDeployment = std::nullopt
 	):
 		m_dispenser{_dialect, _ast, _externallyUsedIdentifiers},
-		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers},
-		m_debug(_debug)
+		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers, _expectedExecutionsPerDeployment},
+		m_debug(_debug),
+		m_budget(_budget),
+		m_startTime(std::chrono::steady_clock::now())
 	{}
 
+	/// @returns true if the step or time budget has been used up.
+	bool budgetExhausted() const;
+
 	NameDispenser m_dispenser;
 	OptimiserStepContext m_context;
 	Debug m_debug;
+	OptimiserBudget m_budget;
+	std::chrono::steady_clock::time_point m_startTime;
+	size_t m_stepsRun = 0;
 };
 
 }
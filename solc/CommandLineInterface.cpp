@@ -36,6 +36,8 @@
 #include <libsolidity/interface/DebugSettings.h>
 
 #include <libyul/AssemblyStack.h>
+#include <libyul/Exceptions.h>
+#include <libyul/optimiser/Suite.h>
 
 #include <libevmasm/Instruction.h>
 #include <libevmasm/GasMeter.h>
@@ -126,6 +128,9 @@ static string const g_strInputFile = "input-file";
 static string const g_strInterface = "interface";
 static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
+static string const g_strYulOptimizations = "yul-optimizations";
+static string const g_strYulOptimizerStepBudget = "yul-optimizer-step-budget";
+static string const g_strYulOptimizerTimeBudget = "yul-optimizer-time-budget";
 static string const g_strIR = "ir";
 static string const g_strIPFS = "ipfs";
 static string const g_strLicense = "license";
@@ -722,6 +727,22 @@ Allowed options)",
 		)
 		(g_strOptimizeYul.c_str(), "Enable Yul optimizer in Solidity. Legacy option: the yul optimizer is enabled as part of the general --optimize option.")
 		(g_strNoOptimizeYul.c_str(), "Disable Yul optimizer in Solidity.")
+		(
+			g_strYulOptimizations.c_str(),
+			po::value<string>()->value_name("steps"),
+			"Forces yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
+		)
+		(
+			g_strYulOptimizerStepBudget.c_str(),
+			po::value<size_t>()->value_name("n"),
+			"Do not start another round of a repeated part of the Yul optimizer step sequence after n steps."
+		)
+		(
+			g_strYulOptimizerTimeBudget.c_str(),
+			po::value<size_t>()->value_name("ms"),
+			"Do not start another round of a repeated part of the Yul optimizer step sequence after the given "
+			"number of milliseconds. Makes the output depend on the speed of the machine."
+		)
 		(g_argPrettyJson.c_str(), "Output JSON in pretty format. Currently it only works with the combined JSON output.")
 		(
 			g_argLibraries.c_str(),
@@ -1000,6 +1021,7 @@ bool CommandLineInterface::processInput()
 		Input inputLanguage = m_args.count(g_argYul) ? Input::Yul : (m_args.count(g_argStrictAssembly) ? Input::StrictAssembly : Input::Assembly);
 		Machine targetMachine = Machine::EVM;
 		bool optimize = m_args.count(g_argOptimize);
+		OptimiserSettings optimiserSettings = optimize ? OptimiserSettings::full() : OptimiserSettings::minimal();
 		if (m_args.count(g_strOptimizeYul))
 		{
 			serr() << "--optimize-yul is invalid in assembly mode. Use --optimize instead." << endl;
@@ -1056,11 +1078,13 @@ bool CommandLineInterface::processInput()
 				endl;
 			return false;
 		}
+		if (!applyYulOptimiserOptions(optimiserSettings))
+			return false;
 		serr() <<
 			"Warning: Yul is still experimental. Please use the output with care." <<
 			endl;
 
-		return assemble(inputLanguage, targetMachine, optimize);
+		return assemble(inputLanguage, targetMachine, optimiserSettings);
 	}
 	if (m_args.count(g_argLink))
 	{
@@ -1116,6 +1140,8 @@ bool CommandLineInterface::processInput()
 		if (m_args.count(g_strNoOptimizeYul))
 			settings.runYulOptimiser = false;
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
+		if (!applyYulOptimiserOptions(settings))
+			return false;
 		m_compiler->setOptimiserSettings(settings);
 
 		if (m_args.count(g_argImportAst))
@@ -1447,10 +1473,46 @@ string CommandLineInterface::objectWithLinkRefsHex(evmasm::LinkerObject const& _
 	return out;
 }
 
+bool CommandLineInterface::applyYulOptimiserOptions(OptimiserSettings& _settings)
+{
+	bool const customised =
+		m_args.count(g_strYulOptimizations) ||
+		m_args.count(g_strYulOptimizerStepBudget) ||
+		m_args.count(g_strYulOptimizerTimeBudget);
+	if (customised && !_settings.runYulOptimiser)
+	{
+		serr() <<
+			"--" << g_strYulOptimizations << ", --" << g_strYulOptimizerStepBudget <<
+			" and --" << g_strYulOptimizerTimeBudget << " are invalid if Yul optimizer is disabled." <<
+			endl;
+		return false;
+	}
+
+	if (m_args.count(g_strYulOptimizations))
+	{
+		string const steps = m_args[g_strYulOptimizations].as<string>();
+		try
+		{
+			yul::OptimiserSuite::validateSequence(steps);
+		}
+		catch (yul::OptimizerException const& _exception)
+		{
+			serr() << "Invalid optimizer step sequence in --" << g_strYulOptimizations << ": " << _exception.what() << endl;
+			return false;
+		}
+		_settings.yulOptimiserSteps = steps;
+	}
+	if (m_args.count(g_strYulOptimizerStepBudget))
+		_settings.yulOptimiserStepBudget = m_args[g_strYulOptimizerStepBudget].as<size_t>();
+	if (m_args.count(g_strYulOptimizerTimeBudget))
+		_settings.yulOptimiserTimeBudget = m_args[g_strYulOptimizerTimeBudget].as<size_t>();
+	return true;
+}
+
 bool CommandLineInterface::assemble(
 	yul::AssemblyStack::Language _language,
 	yul::AssemblyStack::Machine _targetMachine,
-	bool _optimize
+	OptimiserSettings const& _optimiserSettings
 )
 {
 	bool successful = true;
@@ -1460,7 +1522,7 @@ bool CommandLineInterface::assemble(
 		auto& stack = assemblyStacks[src.first] = yul::AssemblyStack(
 			m_evmVersion,
 			_language,
-			_optimize ? OptimiserSettings::full() : OptimiserSettings::minimal()
+			_optimiserSettings
 		);
 		try
 		{
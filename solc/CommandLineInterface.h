@@ -56,7 +56,15 @@ private:
 	/// @returns the full object with library placeholder hints in hex.
 	static std::string objectWithLinkRefsHex(evmasm::LinkerObject const& _obj);
 
-	bool assemble(yul::AssemblyStack::Language _language, yul::AssemblyStack::Machine _targetMachine, bool _optimize);
+	/// Applies the Yul optimiser step sequence and budget options to @a _settings.
+	/// @returns false and prints an error if the options are invalid.
+	bool applyYulOptimiserOptions(OptimiserSettings& _settings);
+
+	bool assemble(
+		yul::AssemblyStack::Language _language,
+		yul::AssemblyStack::Machine _targetMachine,
+		OptimiserSettings const& _optimiserSettings
+	);
 
 	void outputCompilationResults();
 
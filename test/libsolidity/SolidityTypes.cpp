@@ -26,6 +26,8 @@
 #include <libsolutil/Keccak256.h>
 #include <boost/test/unit_test.hpp>
 
+#include <thread>
+
 using namespace std;
 using namespace solidity::langutil;
 
@@ -285,6 +287,31 @@ BOOST_AUTO_TEST_CASE(helper_string_result)
 	BOOST_REQUIRE_EQUAL(r1.message(), "Failure");
 }
 
+BOOST_AUTO_TEST_CASE(type_provider_per_thread)
+{
+	IntegerType const* mainUint = TypeProvider::uint256();
+	StringLiteralType const* mainLiteral = TypeProvider::stringLiteral("abc");
+	bool distinctUint = false;
+	bool equalUint = false;
+	bool distinctLiteral = false;
+	// The types of the worker thread are destroyed once it exits,
+	// so all comparisons have to happen inside of it.
+	thread worker([&]() {
+		IntegerType const* threadUint = TypeProvider::uint256();
+		distinctUint = threadUint != mainUint;
+		equalUint = *threadUint == *mainUint;
+		distinctLiteral = TypeProvider::stringLiteral("abc") != mainLiteral;
+		TypeProvider::reset();
+	});
+	worker.join();
+
+	BOOST_CHECK(distinctUint);
+	BOOST_CHECK(equalUint);
+	BOOST_CHECK(distinctLiteral);
+	// Resetting the other thread's provider must not affect ours.
+	BOOST_CHECK(TypeProvider::stringLiteral("abc") == mainLiteral);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -1063,6 +1063,62 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].asUInt() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_details_yul_steps)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"outputSelection": {
+				"fileA": { "A": [ "metadata" ] }
+			},
+			"optimizer": { "enabled": true, "details": {
+				"yulDetails": {
+					"optimizerSteps": "dhfoD[xarrscLM]uljmu",
+					"stepBudget": 100
+				}
+			} }
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+	// 'l' is not a valid step abbreviation.
+	Json::Value result = compile(util::jsonCompactPrint(parsedInput));
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"Invalid optimizer step sequence in \"settings.optimizer.details.yulDetails.optimizerSteps\": "
+		"'l' is not a valid step abbreviation"
+	));
+
+	parsedInput["settings"]["optimizer"]["details"]["yulDetails"]["optimizerSteps"] = "dhfoD[xarrscLM]ujmu";
+	result = compile(util::jsonCompactPrint(parsedInput));
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "fileA", "A");
+	BOOST_REQUIRE(contract["metadata"].isString());
+	Json::Value metadata;
+	BOOST_REQUIRE(util::jsonParseStrict(contract["metadata"].asString(), metadata));
+	Json::Value const& yulDetails = metadata["settings"]["optimizer"]["details"]["yulDetails"];
+	BOOST_CHECK_EQUAL(yulDetails["optimizerSteps"].asString(), "dhfoD[xarrscLM]ujmu");
+	BOOST_CHECK_EQUAL(yulDetails["stepBudget"].asUInt(), 100);
+	BOOST_CHECK(!yulDetails.isMember("timeBudget"));
+
+	parsedInput["settings"]["optimizer"]["details"]["yulDetails"]["optimizerSteps"] = "dhfoD[xar[rs]cLM]ujmu";
+	result = compile(util::jsonCompactPrint(parsedInput));
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"Invalid optimizer step sequence in \"settings.optimizer.details.yulDetails.optimizerSteps\": "
+		"Nested brackets are not supported"
+	));
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
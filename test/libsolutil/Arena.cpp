@@ -0,0 +1,74 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the arena allocator.
+ */
+
+#include <libsolutil/Arena.h>
+
+#include <test/Options.h>
+
+#include <string>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ArenaTest)
+
+BOOST_AUTO_TEST_CASE(alignment)
+{
+	Arena arena(256);
+	for (size_t alignment: {1, 2, 4, 8, 16, 32})
+	{
+		void* p = arena.allocate(3, alignment);
+		BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(p) % alignment, 0);
+	}
+	BOOST_CHECK_EQUAL(arena.bytesAllocated(), 6 * 3);
+	BOOST_CHECK_EQUAL(arena.bytesReserved(), 256);
+}
+
+BOOST_AUTO_TEST_CASE(oversized)
+{
+	Arena arena(256);
+	arena.allocate(8, 8);
+	arena.allocate(1000, 8);
+	BOOST_CHECK_EQUAL(arena.bytesAllocated(), 1008);
+	// The regular block is still used for small allocations.
+	arena.allocate(8, 8);
+	BOOST_CHECK_EQUAL(arena.bytesReserved(), 256 + 1008);
+}
+
+BOOST_AUTO_TEST_CASE(shared_objects_keep_arena_alive)
+{
+	weak_ptr<Arena> weakArena;
+	shared_ptr<string> s;
+	{
+		auto arena = make_shared<Arena>();
+		weakArena = arena;
+		s = allocate_shared<string>(ArenaAllocator<string>(arena), 100, 'x');
+	}
+	BOOST_CHECK(!weakArena.expired());
+	BOOST_CHECK_EQUAL(*s, string(100, 'x'));
+	s.reset();
+	BOOST_CHECK(weakArena.expired());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
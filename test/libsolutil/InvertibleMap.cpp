@@ -0,0 +1,95 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the checkpoints of InvertibleMap.
+ */
+
+#include <libsolutil/InvertibleMap.h>
+
+#include <test/Options.h>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(InvertibleMapTest)
+
+BOOST_AUTO_TEST_CASE(join_keeps_unchanged)
+{
+	InvertibleMap<int, int> m;
+	m.set(1, 10);
+	m.set(2, 20);
+	m.pushCheckpoint();
+	m.set(3, 30);
+	m.joinWithCheckpoint();
+	BOOST_CHECK((m.values == map<int, int>{{1, 10}, {2, 20}}));
+	BOOST_CHECK(m.checkpoints.empty());
+}
+
+BOOST_AUTO_TEST_CASE(join_removes_modified)
+{
+	InvertibleMap<int, int> m;
+	m.set(1, 10);
+	m.set(2, 20);
+	m.set(3, 30);
+	m.pushCheckpoint();
+	m.set(1, 11);
+	m.eraseKey(2);
+	m.set(3, 31);
+	m.set(3, 30);
+	m.joinWithCheckpoint();
+	BOOST_CHECK((m.values == map<int, int>{{3, 30}}));
+	BOOST_CHECK(m.references[10].empty());
+	BOOST_CHECK(m.references[11].empty());
+	BOOST_CHECK((m.references[30] == set<int>{3}));
+}
+
+BOOST_AUTO_TEST_CASE(join_after_clear)
+{
+	InvertibleMap<int, int> m;
+	m.set(1, 10);
+	m.set(2, 20);
+	m.pushCheckpoint();
+	m.clear();
+	m.set(2, 20);
+	m.joinWithCheckpoint();
+	BOOST_CHECK((m.values == map<int, int>{{2, 20}}));
+}
+
+BOOST_AUTO_TEST_CASE(nested)
+{
+	InvertibleMap<int, int> m;
+	m.set(1, 10);
+	m.set(2, 20);
+	m.pushCheckpoint();
+	m.set(1, 11);
+	m.pushCheckpoint();
+	m.set(1, 10);
+	m.set(2, 21);
+	m.joinWithCheckpoint();
+	// Both keys differ from the inner checkpoint.
+	BOOST_CHECK(m.values.empty());
+	m.set(1, 10);
+	m.joinWithCheckpoint();
+	// Key 1 has the same value as at the outer checkpoint.
+	BOOST_CHECK((m.values == map<int, int>{{1, 10}}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
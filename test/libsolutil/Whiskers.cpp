@@ -192,6 +192,24 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unterminated_tags_rendered)
+{
+	string templ = "<#a>x<?b>y</c><a>";
+	Whiskers m(templ);
+	BOOST_CHECK_EQUAL(m("a", "A").render(), "<#a>x<?b>y</c>A");
+}
+
+BOOST_AUTO_TEST_CASE(shared_template)
+{
+	string templ = "<?c><a><!c>-</c>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "X")("c", true).render(), "X");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "Y")("c", true).render(), "Y");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false).render(), "-");
+	Whiskers m(templ);
+	m("c", true);
+	BOOST_CHECK_THROW(m.render(), WhiskersError);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
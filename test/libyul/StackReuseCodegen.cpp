@@ -70,7 +70,7 @@ BOOST_AUTO_TEST_CASE(single_var_assigned_plus_code)
 BOOST_AUTO_TEST_CASE(single_var_assigned_plus_code_and_reused)
 {
 	string out = assemble("{ let x := 1 mstore(3, 4) pop(mload(x)) }");
-	BOOST_CHECK_EQUAL(out, "PUSH1 0x1 PUSH1 0x4 PUSH1 0x3 MSTORE DUP1 MLOAD POP POP ");
+	BOOST_CHECK_EQUAL(out, "PUSH1 0x1 PUSH1 0x4 PUSH1 0x3 MSTORE MLOAD POP ");
 }
 
 BOOST_AUTO_TEST_CASE(multi_reuse_single_slot)
@@ -90,7 +90,7 @@ BOOST_AUTO_TEST_CASE(multi_reuse_same_variable_name)
 	string out = assemble("{ let z := mload(0) { let x := 1 x := 6 z := x } { let x := 2 z := x x := 4 } }");
 	BOOST_CHECK_EQUAL(out,
 		"PUSH1 0x0 MLOAD "
-		"PUSH1 0x1 PUSH1 0x6 SWAP1 POP DUP1 SWAP2 POP POP "
+		"PUSH1 0x1 PUSH1 0x6 SWAP1 POP SWAP1 POP "
 		"PUSH1 0x2 DUP1 SWAP2 POP PUSH1 0x4 SWAP1 POP POP "
 		"POP "
 	);
@@ -335,8 +335,8 @@ BOOST_AUTO_TEST_CASE(reuse_slots_function_with_gaps)
 		// stack: d c x3 a b
 		"POP "
 		// stack: d c x3 a
-		"DUP1 DUP3 MSTORE "
-		"POP POP "
+		"DUP2 MSTORE " // a is consumed by its last use
+		"POP "
 		// stack: d c
 		"DUP2 DUP2 MSTORE "
 		"POP POP "
@@ -38,10 +38,12 @@
 #include <libyul/optimiser/FunctionHoister.h>
 #include <libyul/optimiser/ExpressionInliner.h>
 #include <libyul/optimiser/FullInliner.h>
+#include <libyul/optimiser/FunctionSpecializer.h>
 #include <libyul/optimiser/ForLoopConditionIntoBody.h>
 #include <libyul/optimiser/ForLoopConditionOutOfBody.h>
 #include <libyul/optimiser/ForLoopInitRewriter.h>
 #include <libyul/optimiser/LoadResolver.h>
+#include <libyul/optimiser/InductionVariableSimplifier.h>
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/MainFunction.h>
 #include <libyul/optimiser/NameDisplacer.h>
@@ -224,6 +226,13 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		FullInliner::run(*m_context, *m_ast);
 		ExpressionJoiner::run(*m_context, *m_ast);
 	}
+	else if (m_optimizerStep == "functionSpecializer")
+	{
+		disambiguate();
+		FunctionHoister::run(*m_context, *m_ast);
+		FunctionGrouper::run(*m_context, *m_ast);
+		FunctionSpecializer::run(*m_context, *m_ast);
+	}
 	else if (m_optimizerStep == "mainFunction")
 	{
 		disambiguate();
@@ -301,6 +310,12 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		ForLoopInitRewriter::run(*m_context, *m_ast);
 		LoopInvariantCodeMotion::run(*m_context, *m_ast);
 	}
+	else if (m_optimizerStep == "inductionVariableSimplifier")
+	{
+		disambiguate();
+		ForLoopInitRewriter::run(*m_context, *m_ast);
+		InductionVariableSimplifier::run(*m_context, *m_ast);
+	}
 	else if (m_optimizerStep == "controlFlowSimplifier")
 	{
 		disambiguate();
@@ -357,7 +372,7 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		yul::Object obj;
 		obj.code = m_ast;
 		obj.analysisInfo = m_analysisInfo;
-		OptimiserSuite::run(*m_dialect, &meter, obj, true);
+		OptimiserSuite::run(*m_dialect, &meter, obj, true, DefaultYulOptimiserSteps);
 	}
 	else
 	{
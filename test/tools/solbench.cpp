@@ -0,0 +1,489 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Benchmark for the individual stages of the compiler front-end.
+ *
+ * Runs the scanner, parser and the analysis steps one after the other over a corpus of
+ * Solidity files and reports throughput, allocations and peak heap usage per stage as JSON.
+ */
+
+#include <libsolidity/analysis/ContractLevelChecker.h>
+#include <libsolidity/analysis/ControlFlowAnalyzer.h>
+#include <libsolidity/analysis/ControlFlowGraph.h>
+#include <libsolidity/analysis/DeclarationContainer.h>
+#include <libsolidity/analysis/GlobalContext.h>
+#include <libsolidity/analysis/NameAndTypeResolver.h>
+#include <libsolidity/analysis/StaticAnalyzer.h>
+#include <libsolidity/analysis/SyntaxChecker.h>
+#include <libsolidity/analysis/TypeChecker.h>
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/TypeProvider.h>
+#include <libsolidity/parsing/Parser.h>
+
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/EVMVersion.h>
+#include <liblangutil/Scanner.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <new>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+/// Heap statistics collected by the replaced global allocation functions below.
+struct HeapStats
+{
+	atomic<size_t> allocations{0};
+	atomic<size_t> allocatedBytes{0};
+	atomic<size_t> liveBytes{0};
+	atomic<size_t> peakLiveBytes{0};
+};
+
+HeapStats g_heap;
+
+/// Every allocation is prefixed with its size so that deallocation can update the live byte count.
+constexpr size_t c_headerSize = alignof(max_align_t);
+
+void* countedAlloc(size_t _size)
+{
+	void* block = malloc(_size + c_headerSize);
+	if (!block)
+		throw bad_alloc();
+	*static_cast<size_t*>(block) = _size;
+	g_heap.allocations++;
+	g_heap.allocatedBytes += _size;
+	size_t live = g_heap.liveBytes += _size;
+	size_t peak = g_heap.peakLiveBytes;
+	while (live > peak && !g_heap.peakLiveBytes.compare_exchange_weak(peak, live))
+	{}
+	return static_cast<char*>(block) + c_headerSize;
+}
+
+void countedFree(void* _pointer)
+{
+	if (!_pointer)
+		return;
+	void* block = static_cast<char*>(_pointer) - c_headerSize;
+	g_heap.liveBytes -= *static_cast<size_t*>(block);
+	free(block);
+}
+
+}
+
+void* operator new(size_t _size) { return countedAlloc(_size); }
+void* operator new[](size_t _size) { return countedAlloc(_size); }
+void operator delete(void* _pointer) noexcept { countedFree(_pointer); }
+void operator delete[](void* _pointer) noexcept { countedFree(_pointer); }
+void operator delete(void* _pointer, size_t) noexcept { countedFree(_pointer); }
+void operator delete[](void* _pointer, size_t) noexcept { countedFree(_pointer); }
+
+namespace
+{
+
+struct StageResult
+{
+	double seconds = 0;
+	size_t allocations = 0;
+	size_t allocatedBytes = 0;
+	/// Highest amount of live heap memory reached during the stage.
+	size_t peakLiveBytes = 0;
+};
+
+struct Source
+{
+	string content;
+	size_t lines = 0;
+	shared_ptr<Scanner> scanner;
+	ASTPointer<SourceUnit> ast;
+};
+
+class FrontendBenchmark
+{
+public:
+	FrontendBenchmark(map<string, string> const& _sources, EVMVersion _evmVersion):
+		m_evmVersion(_evmVersion)
+	{
+		for (auto const& [name, content]: _sources)
+		{
+			m_sources[name].content = content;
+			m_sources[name].lines = size_t(count(content.begin(), content.end(), '\n')) + 1;
+			m_totalLines += m_sources[name].lines;
+			m_totalBytes += content.size();
+		}
+	}
+
+	/// Runs all stages once and adds the measurements to the accumulated results.
+	/// @returns false if the corpus did not compile without errors.
+	bool run()
+	{
+		ErrorList errors;
+		ErrorReporter errorReporter(errors);
+		m_scopes.clear();
+		m_sourceOrder.clear();
+		for (auto& source: m_sources)
+			source.second.ast.reset();
+		TypeProvider::reset();
+
+		bool success = true;
+		try
+		{
+			success = runStages(errorReporter);
+		}
+		catch (FatalError const&)
+		{
+			success = false;
+		}
+
+		if (!success || !Error::containsOnlyWarnings(errors))
+		{
+			SourceReferenceFormatter formatter(cerr);
+			for (auto const& error: errors)
+				formatter.printErrorInformation(*error);
+			return false;
+		}
+		return true;
+	}
+
+	Json::Value results(size_t _repetitions) const
+	{
+		Json::Value output(Json::objectValue);
+		output["sources"] = m_sources.size();
+		output["lines"] = m_totalLines;
+		output["bytes"] = m_totalBytes;
+		output["repetitions"] = _repetitions;
+		Json::Value stages(Json::arrayValue);
+		for (string const& name: m_stageOrder)
+		{
+			StageResult const& result = m_results.at(name);
+			double seconds = result.seconds / double(_repetitions);
+			Json::Value stage(Json::objectValue);
+			stage["name"] = name;
+			stage["seconds"] = seconds;
+			stage["linesPerSecond"] = seconds > 0 ? double(m_totalLines) / seconds : 0.0;
+			stage["allocations"] = result.allocations / _repetitions;
+			stage["allocatedBytes"] = result.allocatedBytes / _repetitions;
+			stage["peakLiveBytes"] = result.peakLiveBytes;
+			stages.append(stage);
+		}
+		output["stages"] = stages;
+		rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) == 0)
+			output["maxResidentSetKiB"] = Json::Int64(usage.ru_maxrss);
+		return output;
+	}
+
+private:
+	bool runStages(ErrorReporter& _errorReporter)
+	{
+		measure("scanner", [&]() {
+			for (auto& source: m_sources)
+			{
+				Scanner scanner{CharStream(source.second.content, source.first)};
+				while (scanner.currentToken() != Token::EOS)
+					scanner.next();
+			}
+			return true;
+		});
+
+		bool success = measure("parser", [&]() {
+			Parser parser{_errorReporter, m_evmVersion};
+			for (auto& source: m_sources)
+			{
+				source.second.scanner = make_shared<Scanner>(CharStream(source.second.content, source.first));
+				source.second.ast = parser.parse(source.second.scanner);
+				if (!source.second.ast)
+					return false;
+				source.second.ast->annotation().path = source.first;
+			}
+			return true;
+		});
+		if (!success || !resolveImports(_errorReporter))
+			return false;
+
+		success = measure("syntaxChecker", [&]() {
+			SyntaxChecker syntaxChecker(_errorReporter, false);
+			bool noErrors = true;
+			for (Source const* source: m_sourceOrder)
+				if (!syntaxChecker.checkSyntax(*source->ast))
+					noErrors = false;
+			return noErrors;
+		});
+		if (!success)
+			return false;
+
+		GlobalContext globalContext;
+		success = measure("nameAndTypeResolver", [&]() {
+			NameAndTypeResolver resolver(globalContext, m_evmVersion, m_scopes, _errorReporter);
+			for (Source const* source: m_sourceOrder)
+				if (!resolver.registerDeclarations(*source->ast))
+					return false;
+			map<string, SourceUnit const*> sourceUnitsByName;
+			for (auto const& source: m_sources)
+				sourceUnitsByName[source.first] = source.second.ast.get();
+			for (Source const* source: m_sourceOrder)
+				if (!resolver.performImports(*source->ast, sourceUnitsByName))
+					return false;
+			for (Source const* source: m_sourceOrder)
+				for (ASTPointer<ASTNode> const& node: source->ast->nodes())
+					if (!resolver.resolveNamesAndTypes(*node))
+						return false;
+			return true;
+		});
+		if (!success)
+			return false;
+
+		success = measure("contractLevelChecker", [&]() {
+			ContractLevelChecker contractLevelChecker(_errorReporter);
+			bool noErrors = true;
+			for (ContractDefinition const* contract: contracts())
+				if (!contractLevelChecker.check(*contract))
+					noErrors = false;
+			return noErrors;
+		});
+
+		success = measure("typeChecker", [&]() {
+			TypeChecker typeChecker(m_evmVersion, _errorReporter);
+			bool noErrors = true;
+			for (ContractDefinition const* contract: contracts())
+				if (!typeChecker.checkTypeRequirements(*contract))
+					noErrors = false;
+			return noErrors;
+		}) && success;
+		if (!success)
+			return false;
+
+		success = measure("controlFlowAnalyzer", [&]() {
+			CFG cfg(_errorReporter);
+			for (Source const* source: m_sourceOrder)
+				if (!cfg.constructFlow(*source->ast))
+					return false;
+			ControlFlowAnalyzer controlFlowAnalyzer(cfg, _errorReporter);
+			bool noErrors = true;
+			for (Source const* source: m_sourceOrder)
+				if (!controlFlowAnalyzer.analyze(*source->ast))
+					noErrors = false;
+			return noErrors;
+		});
+		if (!success)
+			return false;
+
+		return measure("staticAnalyzer", [&]() {
+			StaticAnalyzer staticAnalyzer(_errorReporter);
+			bool noErrors = true;
+			for (Source const* source: m_sourceOrder)
+				if (!staticAnalyzer.analyze(*source->ast))
+					noErrors = false;
+			return noErrors;
+		});
+	}
+
+	bool measure(string const& _name, function<bool()> const& _stage)
+	{
+		if (!m_results.count(_name))
+			m_stageOrder.push_back(_name);
+		StageResult& result = m_results[_name];
+
+		size_t allocations = g_heap.allocations;
+		size_t allocatedBytes = g_heap.allocatedBytes;
+		g_heap.peakLiveBytes = size_t(g_heap.liveBytes);
+		auto start = chrono::steady_clock::now();
+		bool success = _stage();
+		auto end = chrono::steady_clock::now();
+
+		result.seconds += chrono::duration<double>(end - start).count();
+		result.allocations += g_heap.allocations - allocations;
+		result.allocatedBytes += g_heap.allocatedBytes - allocatedBytes;
+		result.peakLiveBytes = max(result.peakLiveBytes, size_t(g_heap.peakLiveBytes));
+		return success;
+	}
+
+	/// Sorts the sources topologically along their imports, like CompilerStack does.
+	bool resolveImports(ErrorReporter& _errorReporter)
+	{
+		set<Source const*> sourcesSeen;
+		bool success = true;
+		function<void(Source const*)> toposort = [&](Source const* _source)
+		{
+			if (sourcesSeen.count(_source))
+				return;
+			sourcesSeen.insert(_source);
+			for (ASTPointer<ASTNode> const& node: _source->ast->nodes())
+				if (ImportDirective const* import = dynamic_cast<ImportDirective*>(node.get()))
+				{
+					string path = util::absolutePath(import->path(), _source->ast->annotation().path);
+					if (!m_sources.count(path))
+					{
+						_errorReporter.parserError(import->location(), "Source \"" + path + "\" not found in the corpus.");
+						success = false;
+						continue;
+					}
+					import->annotation().absolutePath = path;
+					import->annotation().sourceUnit = m_sources.at(path).ast.get();
+					toposort(&m_sources.at(path));
+				}
+			m_sourceOrder.push_back(_source);
+		};
+		for (auto const& source: m_sources)
+			toposort(&source.second);
+		return success;
+	}
+
+	vector<ContractDefinition const*> contracts() const
+	{
+		vector<ContractDefinition const*> contracts;
+		for (Source const* source: m_sourceOrder)
+			for (auto const* contract: ASTNode::filteredNodes<ContractDefinition>(source->ast->nodes()))
+				contracts.push_back(contract);
+		return contracts;
+	}
+
+	EVMVersion m_evmVersion;
+	map<string, Source> m_sources;
+	vector<Source const*> m_sourceOrder;
+	map<ASTNode const*, shared_ptr<DeclarationContainer>> m_scopes;
+	size_t m_totalLines = 0;
+	size_t m_totalBytes = 0;
+	vector<string> m_stageOrder;
+	map<string, StageResult> m_results;
+};
+
+/// Reads all Solidity files below @a _path, naming them relative to @a _path.
+void readCorpus(fs::path const& _path, map<string, string>& _sources)
+{
+	if (fs::is_regular_file(_path))
+	{
+		_sources[_path.filename().generic_string()] = readFileAsString(_path.string());
+		return;
+	}
+	for (auto const& entry: fs::recursive_directory_iterator(_path))
+		if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".sol")
+			_sources[fs::relative(entry.path(), _path).generic_string()] = readFileAsString(entry.path().string());
+}
+
+}
+
+int main(int argc, char const** argv)
+{
+	po::options_description options(
+		R"(solbench, the Solidity front-end benchmark.
+Usage: solbench [Options] <corpus> ...
+Each corpus is a Solidity file or a directory whose ".sol" files are compiled together,
+with imports resolved relative to the directory. The results are printed as JSON.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("repeat", po::value<size_t>()->default_value(5), "Number of times each corpus is processed.")
+		("evm-version", po::value<string>(), "Target EVM version.")
+		("corpus", po::value<vector<string>>(), "Files or directories to benchmark.")
+		("help", "Show this help screen.");
+
+	po::positional_options_description filesPositions;
+	filesPositions.add("corpus", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+		po::notify(arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("corpus"))
+	{
+		cout << options;
+		return arguments.count("help") ? 0 : 1;
+	}
+
+	EVMVersion evmVersion;
+	if (arguments.count("evm-version"))
+	{
+		string versionString = arguments["evm-version"].as<string>();
+		optional<EVMVersion> version = EVMVersion::fromString(versionString);
+		if (!version)
+		{
+			cerr << "Invalid EVM version: " << versionString << endl;
+			return 1;
+		}
+		evmVersion = *version;
+	}
+
+	size_t repetitions = max<size_t>(arguments["repeat"].as<size_t>(), 1);
+	Json::Value output(Json::objectValue);
+	bool success = true;
+	for (string const& corpus: arguments["corpus"].as<vector<string>>())
+	{
+		map<string, string> sources;
+		try
+		{
+			readCorpus(corpus, sources);
+		}
+		catch (fs::filesystem_error const& _exception)
+		{
+			cerr << _exception.what() << endl;
+			return 1;
+		}
+
+		FrontendBenchmark benchmark(sources, evmVersion);
+		bool corpusSuccess = true;
+		for (size_t i = 0; i < repetitions && corpusSuccess; ++i)
+			corpusSuccess = benchmark.run();
+		if (corpusSuccess)
+			output[corpus] = benchmark.results(repetitions);
+		else
+		{
+			cerr << "Corpus " << corpus << " failed to compile." << endl;
+			success = false;
+		}
+	}
+	cout << jsonPrettyPrint(output) << endl;
+	return success ? 0 : 1;
+}
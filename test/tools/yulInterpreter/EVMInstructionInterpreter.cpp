@@ -434,6 +434,8 @@ u256 EVMInstructionInterpreter::evalBuiltin(BuiltinFunctionForEVM const& _fun, c
 		return u256(keccak256(h256(_arguments.at(0)))) & 0xfff;
 	else if (_fun.name == "dataoffset"_yulstring)
 		return u256(keccak256(h256(_arguments.at(0) + 2))) & 0xfff;
+	else if (_fun.name == "memoryguard"_yulstring)
+		return _arguments.at(0);
 	else if (_fun.name == "datacopy"_yulstring)
 	{
 		// This is identical to codecopy.